@@ -0,0 +1,70 @@
+#ifndef __CRC_H__
+#define __CRC_H__
+
+/* Dependencies */
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+/**
+ * @brief Initial values of the checksums computed by `CRC`.
+ */
+#define CRC16_INIT (const uint16_t)0xFFFF
+#define CRC8_INIT  (const uint8_t)0x00
+
+/**
+ * @brief Table-driven checksums for framed binary protocols.
+ * @details CRC-16/CCITT-FALSE (polynomial 0x1021, init 0xFFFF, not reflected) and CRC-8 (polynomial 0x07, init 0x00). Each
+ *          byte costs one table lookup in program memory instead of eight shift and xor steps, and the CRC can be updated byte
+ *          by byte as data arrives. Appending the CRC-16 most significant byte first to a message makes the CRC of the whole
+ *          message 0.
+ * @note The tables take 512 and 256 bytes of flash, they are discarded by the linker when unused.
+ */
+class CRC
+{
+    public:
+        /**
+         * @brief Updates a CRC-16/CCITT-FALSE with one byte
+         * @param crc The current CRC, `CRC16_INIT` for a new message
+         * @param byte The byte
+         * @return The updated CRC
+         */
+        static inline const uint16_t crc16(const uint16_t crc, const uint8_t byte)
+        {
+            return ((uint16_t)(crc << 8) ^ pgm_read_word(&TABLE16[(uint8_t)(crc >> 8) ^ byte]));
+        }
+
+        /**
+         * @brief Updates a CRC-16/CCITT-FALSE with a byte array
+         * @param crc The current CRC, `CRC16_INIT` for a new message
+         * @param n Pointer to the byte array
+         * @param size The number of bytes
+         * @return The updated CRC
+         */
+        static const uint16_t crc16(uint16_t crc, const uint8_t* n, uint8_t size);
+
+        /**
+         * @brief Updates a CRC-8 with one byte
+         * @param crc The current CRC, `CRC8_INIT` for a new message
+         * @param byte The byte
+         * @return The updated CRC
+         */
+        static inline const uint8_t crc8(const uint8_t crc, const uint8_t byte)
+        {
+            return (pgm_read_byte(&TABLE8[crc ^ byte]));
+        }
+
+        /**
+         * @brief Updates a CRC-8 with a byte array
+         * @param crc The current CRC, `CRC8_INIT` for a new message
+         * @param n Pointer to the byte array
+         * @param size The number of bytes
+         * @return The updated CRC
+         */
+        static const uint8_t crc8(uint8_t crc, const uint8_t* n, uint8_t size);
+
+    private:
+        static const uint16_t TABLE16[256]; /**< CRC-16/CCITT-FALSE table in program memory */
+        static const uint8_t TABLE8[256];   /**< CRC-8 table in program memory */
+};
+
+#endif
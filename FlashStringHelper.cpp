@@ -23,7 +23,7 @@ FlashStringHelper::~FlashStringHelper()
  * @brief  Getting the pointer to the string stored in flash memory
  * @return Returns the apointer to the string stored in flash memory
  */
-const char* FlashStringHelper::get(void)
+const char* FlashStringHelper::get(void) const
 {
     return (this->ptr);
 }
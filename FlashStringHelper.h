@@ -10,7 +10,7 @@ class FlashStringHelper
     public:
         FlashStringHelper(const char* str);
         ~FlashStringHelper();
-        const char* get(void);
+        const char* get(void) const;
     private:
         const char* ptr;
 };
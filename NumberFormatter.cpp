@@ -0,0 +1,194 @@
+/* Dependencies */
+#include <string.h>
+#include "NumberFormatter.h"
+
+/**
+ * @brief Powers of ten subtracted while the value does not fit 16 bits.
+ */
+static const uint32_t POWERS_OF_TEN_32[] PROGMEM = { 1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL };
+
+/**
+ * @brief Powers of ten subtracted once the value fits 16 bits.
+ */
+static const uint16_t POWERS_OF_TEN_16[] PROGMEM = { 10000, 1000, 100, 10 };
+
+/**
+ * @brief Renders the digits of a 16-bit value by subtracting powers of ten.
+ * @param n The value to render
+ * @param p Destination
+ * @param first Index of the first power of ten in `POWERS_OF_TEN_16` to try
+ * @param pad 1 to render leading zeros, 0 to skip them
+ * @return Pointer past the last character written
+ */
+static char* digits16(uint16_t n, char* p, const uint8_t first, uint8_t pad)
+{
+    for (uint8_t i = first; i < sizeof(POWERS_OF_TEN_16) / sizeof(POWERS_OF_TEN_16[0]); i++)
+    {
+        const uint16_t power = pgm_read_word(&POWERS_OF_TEN_16[i]);
+        char digit = '0';
+        while (n >= power)
+        {
+            n -= power;
+            digit++;
+        }
+        if (pad || digit != '0')
+        {
+            *p++ = digit;
+            pad = 1;
+        }
+    }
+    *p++ = (char)('0' + n);
+    return (p);
+}
+
+/**
+ * @brief Renders an unsigned 8-bit integer as decimal ASCII digits.
+ * @param n The value to render
+ * @param buffer Destination, at least 3 bytes
+ * @return The number of characters written (no null terminator)
+ */
+const uint8_t NumberFormatter::decimal(const uint8_t n, char* buffer)
+{
+    return (digits16(n, buffer, 2, 0) - buffer); /*!< Start at the hundreds */
+}
+
+/**
+ * @brief Renders an unsigned 16-bit integer as decimal ASCII digits.
+ * @param n The value to render
+ * @param buffer Destination, at least 5 bytes
+ * @return The number of characters written (no null terminator)
+ */
+const uint8_t NumberFormatter::decimal(const uint16_t n, char* buffer)
+{
+    return (digits16(n, buffer, 0, 0) - buffer);
+}
+
+/**
+ * @brief Renders an unsigned 32-bit integer as decimal ASCII digits.
+ * @param n The value to render
+ * @param buffer Destination, at least 10 bytes
+ * @return The number of characters written (no null terminator)
+ * @details Values above 65535 subtract 32-bit powers of ten down to 10^4. The remainder is then below 10000 and the last four
+ *          digits (including zeros) are rendered with 16-bit arithmetic.
+ */
+const uint8_t NumberFormatter::decimal(const uint32_t n, char* buffer)
+{
+    if (n <= UINT16_MAX)
+        return (NumberFormatter::decimal((const uint16_t)n, buffer));
+
+    uint32_t remainder = n;
+    char* p = buffer;
+    uint8_t pad = 0;
+    for (uint8_t i = 0; i < sizeof(POWERS_OF_TEN_32) / sizeof(POWERS_OF_TEN_32[0]); i++)
+    {
+        const uint32_t power = pgm_read_dword(&POWERS_OF_TEN_32[i]);
+        char digit = '0';
+        while (remainder >= power)
+        {
+            remainder -= power;
+            digit++;
+        }
+        if (pad || digit != '0')
+        {
+            *p++ = digit;
+            pad = 1;
+        }
+    }
+    return (digits16((uint16_t)remainder, p, 1, 1) - buffer); /*!< Thousands down to units, zeros included */
+}
+
+/**
+ * @brief Renders a signed 32-bit integer as decimal ASCII digits, preceded by '-' when negative.
+ * @param n The value to render
+ * @param buffer Destination, at least `NUMBER_FORMATTER_BUFFER_SIZE` bytes
+ * @return The number of characters written (no null terminator)
+ * @note The magnitude is computed in unsigned arithmetic, so INT32_MIN is rendered correctly.
+ */
+const uint8_t NumberFormatter::decimal(const int32_t n, char* buffer)
+{
+    if (n >= 0)
+        return (NumberFormatter::decimal((const uint32_t)n, buffer));
+
+    buffer[0] = '-';
+    return (1 + NumberFormatter::decimal((const uint32_t)(0UL - (uint32_t)n), buffer + 1));
+}
+
+/**
+ * @brief Renders an unsigned 32-bit integer in base 2, 8, 10 or 16.
+ * @param n The value to render
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`, any other base renders decimal
+ * @param buffer Destination, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+ * @return The number of characters written (no null terminator)
+ * @details Power of two bases only need shifts and masks: the digit count is found first, then the digits are filled from the
+ *          least significant one. Hexadecimal digits are upper case.
+ */
+const uint8_t NumberFormatter::radix(const uint32_t n, const uint8_t base, char* buffer)
+{
+    uint8_t shift;
+    switch (base)
+    {
+        case BIN: shift = 1; break;
+        case OCT: shift = 3; break;
+        case HEX: shift = 4; break;
+        default:  return (NumberFormatter::decimal(n, buffer));
+    }
+
+    const uint8_t mask = (uint8_t)((1 << shift) - 1);
+    uint8_t length = 1;
+    for (uint32_t rest = n >> shift; rest; rest >>= shift)
+        length++;
+
+    uint32_t rest = n;
+    for (char* p = buffer + length; p != buffer; rest >>= shift)
+    {
+        const uint8_t digit = (uint8_t)rest & mask;
+        *--p = (char)((digit < 10) ? ('0' + digit) : ('A' - 10 + digit));
+    }
+    return (length);
+}
+
+/**
+ * @brief Pads a rendered number with leading zeros, after its sign if any.
+ * @param buffer The rendered number, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+ * @param length The number of characters in `buffer`
+ * @param width The minimum number of characters, clamped to `NUMBER_FORMATTER_RADIX_BUFFER_SIZE`
+ * @return The new number of characters in `buffer`
+ */
+const uint8_t NumberFormatter::pad(char* buffer, const uint8_t length, uint8_t width)
+{
+    if (width > NUMBER_FORMATTER_RADIX_BUFFER_SIZE)
+        width = NUMBER_FORMATTER_RADIX_BUFFER_SIZE;
+    if (width <= length)
+        return (length);
+
+    const uint8_t sign = (buffer[0] == '-');
+    const uint8_t zeros = width - length;
+    memmove(buffer + sign + zeros, buffer + sign, length - sign);
+    memset(buffer + sign, '0', zeros);
+    return (width);
+}
+
+/**
+ * @brief Renders a fixed-point value, e.g. `fixed(-1234, 2)` renders "-12.34".
+ * @param n The value, scaled by 10^decimals
+ * @param decimals The number of fractional digits, clamped to 10
+ * @param buffer Destination, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+ * @return The number of characters written (no null terminator)
+ * @details The value is rendered as a decimal integer, padded to at least one integer digit plus `decimals` digits, and the
+ *          decimal point is inserted in front of the fractional digits. No floating point code is involved.
+ */
+const uint8_t NumberFormatter::fixed(const int32_t n, uint8_t decimals, char* buffer)
+{
+    if (decimals > 10)
+        decimals = 10;
+
+    uint8_t length = NumberFormatter::decimal(n, buffer);
+    if (!decimals)
+        return (length);
+
+    length = NumberFormatter::pad(buffer, length, (buffer[0] == '-') + decimals + 1);
+    char* point = buffer + length - decimals;
+    memmove(point + 1, point, decimals);
+    *point = '.';
+    return (length + 1);
+}
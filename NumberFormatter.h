@@ -0,0 +1,107 @@
+#ifndef __NUMBER_FORMATTER_H__
+#define __NUMBER_FORMATTER_H__
+
+/* Dependencies */
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+/**
+ * @brief Size of a buffer able to hold any number rendered by `NumberFormatter`.
+ * @details 10 digits of a `uint32_t` plus the sign of an `int32_t`. No null terminator is written.
+ */
+#define NUMBER_FORMATTER_BUFFER_SIZE (const uint8_t)11
+
+/**
+ * @brief Size of a buffer able to hold any number rendered in another base, zero padded or in fixed-point.
+ * @details 32 binary digits of a `uint32_t`, or a sign followed by up to 32 digits when zero padded to the maximum width.
+ */
+#define NUMBER_FORMATTER_RADIX_BUFFER_SIZE (const uint8_t)33
+
+/**
+ * @brief Number bases understood by `NumberFormatter::radix()` and the base-aware `print()` overloads.
+ * @note The values match the Arduino core definitions, so both headers can be included together.
+ */
+#ifndef BIN
+#define BIN 2
+#endif
+#ifndef OCT
+#define OCT 8
+#endif
+#ifndef DEC
+#define DEC 10
+#endif
+#ifndef HEX
+#define HEX 16
+#endif
+
+/**
+ * @brief Integer to ASCII engine without divisions.
+ * @details AVR has no hardware divider, a 32-bit `n / 10` is a software routine of several hundred cycles. The digits are
+ *          instead obtained by repeatedly subtracting powers of ten read from a table in program memory, at most 9 subtractions
+ *          per digit, using 16-bit arithmetic as soon as the remainder fits. The digits are rendered into a caller provided
+ *          buffer, so they can be transmitted with a single bulk write.
+ */
+class NumberFormatter
+{
+    public:
+        /**
+         * @brief Renders an unsigned 8-bit integer as decimal ASCII digits.
+         * @param n The value to render
+         * @param buffer Destination, at least 3 bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t decimal(const uint8_t n, char* buffer);
+
+        /**
+         * @brief Renders an unsigned 16-bit integer as decimal ASCII digits.
+         * @param n The value to render
+         * @param buffer Destination, at least 5 bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t decimal(const uint16_t n, char* buffer);
+
+        /**
+         * @brief Renders an unsigned 32-bit integer as decimal ASCII digits.
+         * @param n The value to render
+         * @param buffer Destination, at least 10 bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t decimal(const uint32_t n, char* buffer);
+
+        /**
+         * @brief Renders a signed 32-bit integer as decimal ASCII digits, preceded by '-' when negative.
+         * @param n The value to render
+         * @param buffer Destination, at least `NUMBER_FORMATTER_BUFFER_SIZE` bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t decimal(const int32_t n, char* buffer);
+
+        /**
+         * @brief Renders an unsigned 32-bit integer in base 2, 8, 10 or 16.
+         * @param n The value to render
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`, any other base renders decimal
+         * @param buffer Destination, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t radix(const uint32_t n, const uint8_t base, char* buffer);
+
+        /**
+         * @brief Pads a rendered number with leading zeros, after its sign if any.
+         * @param buffer The rendered number, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+         * @param length The number of characters in `buffer`
+         * @param width The minimum number of characters, clamped to `NUMBER_FORMATTER_RADIX_BUFFER_SIZE`
+         * @return The new number of characters in `buffer`
+         */
+        static const uint8_t pad(char* buffer, const uint8_t length, uint8_t width);
+
+        /**
+         * @brief Renders a fixed-point value, e.g. `fixed(-1234, 2)` renders "-12.34".
+         * @param n The value, scaled by 10^decimals
+         * @param decimals The number of fractional digits, clamped to 10
+         * @param buffer Destination, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+         * @return The number of characters written (no null terminator)
+         */
+        static const uint8_t fixed(const int32_t n, uint8_t decimals, char* buffer);
+};
+
+#endif
@@ -0,0 +1,275 @@
+#ifndef __PRINTER_H__
+#define __PRINTER_H__
+
+/* Dependencies */
+#include <stdint.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+#include "FlashStringHelper.h"
+#include "NumberFormatter.h"
+
+/**
+ * @brief Size of the stack buffer used by the default `Printer::printFlash()`.
+ */
+#ifndef PRINTER_FLASH_CHUNK_SIZE
+#define PRINTER_FLASH_CHUNK_SIZE (const uint8_t)16
+#endif
+
+/**
+ * @brief Formatting front end shared by every byte sink.
+ * @details `print()`, `println()` and `printf()` render text and numbers into small stack buffers and hand them to the sink with
+ *          one bulk write. The sink derives from `Printer` with itself as template argument (CRTP), so the calls to the sink
+ *          are resolved at compile time and inlined, without the virtual calls of Arduino's `Print`. A sink provides:
+ *          - `write(const uint8_t n)` and `write(const uint8_t* n, const uint8_t size)`.
+ *          - Optionally `printFlash(const char** s, const char stop)`, streaming a string from program memory up to its null
+ *            terminator or `stop` (advancing `*s` to it). The default copies the string through a stack buffer of
+ *            `PRINTER_FLASH_CHUNK_SIZE` bytes.
+ * @code
+ * class RAMLog : public Printer<RAMLog>
+ * {
+ *     public:
+ *         void write(const uint8_t n) { ... }
+ *         void write(const uint8_t* n, const uint8_t size) { ... }
+ * };
+ * @endcode
+ * @note A sink declaring its members private must declare `friend class Printer<SINK>`.
+ */
+
+template <class SINK>
+class Printer
+{
+    public:
+        /**
+         * @brief Prints a single character.
+         * @param c Character to be transmitted.
+         */
+        void print(const char c);
+
+        /**
+         * @brief Prints a null-terminated string.
+         * @param s Pointer to the null-terminated string to be transmitted.
+         */
+        void print(const char* s);
+
+        /**
+         * @brief Prints a string stored in program memory (Flash).
+         * @param s Reference to a FlashStringHelper object containing the string in program memory.
+         */
+        void print(const FlashStringHelper &s);
+
+        /**
+         * @brief Prints an unsigned 8-bit integer as ASCII digits.
+         * @param n The uint8_t value to be printed (range 0-255).
+         */
+        void print(const uint8_t n);
+
+        /**
+         * @brief Prints an unsigned 16-bit integer as ASCII digits.
+         * @param n The uint16_t value to be printed (range 0-65535).
+         */
+        void print(const uint16_t n);
+
+        /**
+         * @brief Prints an unsigned 32-bit integer as ASCII digits.
+         * @param n The uint32_t value to be printed (range 0-4294967295).
+         */
+        void print(const uint32_t n);
+
+        /**
+         * @brief Prints a signed 8-bit integer as ASCII digits.
+         * @param n The int8_t value to be printed (range -128 to 127).
+         */
+        void print(const int8_t n);
+
+        /**
+         * @brief Prints a signed 16-bit integer as ASCII digits.
+         * @param n The int16_t value to be printed (range -32768 to 32767).
+         */
+        void print(const int16_t n);
+
+        /**
+         * @brief Prints a signed 32-bit integer as ASCII digits.
+         * @param n The int32_t value to be printed (range -2147483648 to 2147483647).
+         */
+        void print(const int32_t n);
+
+        /**
+         * @brief Prints an unsigned 8-bit integer in the given base.
+         * @param n The uint8_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const uint8_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints an unsigned 16-bit integer in the given base.
+         * @param n The uint16_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const uint16_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints an unsigned 32-bit integer in the given base.
+         * @param n The uint32_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const uint32_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints a signed 8-bit integer in the given base.
+         * @param n The int8_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const int8_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints a signed 16-bit integer in the given base.
+         * @param n The int16_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const int16_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints a signed 32-bit integer in the given base.
+         * @param n The int32_t value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        void print(const int32_t n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints a fixed-point value, e.g. `printFixed(-1234, 2)` prints "-12.34".
+         * @param n The value, scaled by 10^decimals.
+         * @param decimals The number of fractional digits (0 to 10).
+         */
+        void printFixed(const int32_t n, const uint8_t decimals);
+
+        /**
+         * @brief Prints a formatted string without avr-libc's vfprintf.
+         * @param format Reference to a FlashStringHelper object containing the format string in program memory.
+         * @param args The values of the conversions.
+         */
+        template <class... ARGS>
+        void printf(const FlashStringHelper &format, const ARGS&... args);
+
+        /**
+         * @brief Prints a newline character ('\n').
+         */
+        void println(void);
+
+        /**
+         * @brief Prints a value followed by a newline ('\n').
+         * @param n Any value accepted by `print()`.
+         */
+        template <class T>
+        void println(const T& n);
+
+        /**
+         * @brief Prints an integer in the given base followed by a newline ('\n').
+         * @param n The value to be printed.
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+         * @param width Minimum number of digits, padded with leading zeros (0 for none).
+         */
+        template <class T>
+        void println(const T& n, const uint8_t base, const uint8_t width = 0);
+
+        /**
+         * @brief Prints a fixed-point value followed by a newline.
+         * @param n The value, scaled by 10^decimals.
+         * @param decimals The number of fractional digits (0 to 10).
+         */
+        void printlnFixed(const int32_t n, const uint8_t decimals);
+
+    protected:
+        /**
+         * @brief Streams a string from program memory to the sink, in chunks copied through a stack buffer
+         * @param s Pointer to the string in program memory, advanced to the null terminator or to `stop`
+         * @param stop Character ending the string besides the null terminator (0 for none)
+         * @note Hidden by the `printFlash()` of sinks able to stream from flash directly.
+         */
+        void printFlash(const char** s, const char stop);
+
+    private:
+        /**
+         * @brief Returns the sink deriving from this printer
+         * @return Reference to the sink
+         */
+        SINK& sink(void);
+
+        /**
+         * @brief Prints the literal part of a printf format string, up to its next conversion
+         * @param format Pointer to the format string in program memory, advanced past the conversion
+         * @param base Set to the base of the conversion
+         * @param width Set to the minimum width of the conversion
+         * @param fill Set to the padding of the conversion: '0', ' ' or '-' (left justified)
+         * @return 1 if a conversion was found, 0 once the end of the format string has been reached
+         */
+        const uint8_t printfLiteral(const char** format, uint8_t* base, uint8_t* width, char* fill);
+
+        /**
+         * @brief Prints the rest of a printf format string once every argument has been consumed
+         * @param format Pointer to the format string in program memory
+         */
+        void printfNext(const char* format);
+
+        /**
+         * @brief Prints the next literal part of a printf format string and the argument of its conversion
+         * @param format Pointer to the format string in program memory
+         * @param arg The argument of the next conversion
+         * @param args The remaining arguments
+         */
+        template <class T, class... ARGS>
+        void printfNext(const char* format, const T& arg, const ARGS&... args);
+
+        /**
+         * @brief Prints a printf argument with the base, the width and the padding of its conversion
+         * @param n The argument
+         * @param base The base of the conversion
+         * @param width The minimum width of the conversion
+         * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+         */
+        void printfArg(const char n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const char* n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const FlashStringHelper &n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const uint8_t n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const uint16_t n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const uint32_t n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const int8_t n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const int16_t n, const uint8_t base, const uint8_t width, const char fill);
+        void printfArg(const int32_t n, const uint8_t base, const uint8_t width, const char fill);
+
+        /**
+         * @brief Prints an unsigned value in the given base, padded to a minimum width
+         * @param n The value to be printed
+         * @param base `BIN`, `OCT`, `DEC` or `HEX`
+         * @param width Minimum number of digits
+         * @param fill '0' for leading zeros, ' ' for leading spaces, '-' for trailing spaces
+         */
+        void printRadix(const uint32_t n, const uint8_t base, const uint8_t width, const char fill = '0');
+
+        /**
+         * @brief Prints a signed value in decimal, padded to a minimum width
+         * @param n The value to be printed
+         * @param width Minimum number of characters, sign included
+         * @param fill '0' for zeros after the sign, ' ' for leading spaces, '-' for trailing spaces
+         */
+        void printDecimal(const int32_t n, const uint8_t width, const char fill = '0');
+
+        /**
+         * @brief Sends a rendered number padded to a minimum width
+         * @param buffer The rendered number, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+         * @param length The number of characters in `buffer`
+         * @param width Minimum number of characters
+         * @param fill '0' for zeros after the sign, ' ' for leading spaces, '-' for trailing spaces
+         */
+        void printPadded(char* buffer, const uint8_t length, const uint8_t width, const char fill);
+};
+
+/* Implementation */
+#include "Printer.tpp"
+
+#endif
@@ -0,0 +1,626 @@
+/* Implementation of the Printer template, included by Printer.h */
+
+/**
+ * @brief Prints a single character.
+ * @param c Character to be transmitted.
+ * @details Converts the char to uint8_t and hands it to the sink's write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const char c)
+{
+    this->sink().write((const uint8_t)c);
+}
+
+/**
+ * @brief Prints a null-terminated string.
+ * @param s Pointer to the null-terminated string to be transmitted.
+ * @details Measures the string with `strlen()` and hands it to the sink with bulk writes of up to 255 characters, instead of
+ *          one write() call per character.
+ */
+template <class SINK>
+void Printer<SINK>::print(const char* s)
+{
+    size_t length = strlen(s);
+    while (length)
+    {
+        const uint8_t chunk = (length > UINT8_MAX) ? UINT8_MAX : (uint8_t)length;
+        this->sink().write((const uint8_t*)s, chunk);
+        s += chunk;
+        length -= chunk;
+    }
+}
+
+/**
+ * @brief Prints a string stored in program memory (Flash).
+ * @param s Reference to a FlashStringHelper object containing the string in program memory.
+ * @details Streams the string with the `printFlash()` of the sink, e.g. `__UART__` copies it from program memory straight
+ *          into its transmit buffer.
+ * @note This method is specific for AVR microcontrollers where strings can be stored
+ *       in program memory (Flash) to save RAM.
+ */
+template <class SINK>
+void Printer<SINK>::print(const FlashStringHelper &s)
+{
+    const char* ptr = s.get();
+    this->sink().printFlash(&ptr, 0);
+}
+
+/**
+ * @brief Prints an unsigned 8-bit integer as ASCII digits.
+ * @param n The uint8_t value to be printed (range 0-255).
+ * @details Renders the digits into a stack buffer with `NumberFormatter::decimal()`, which subtracts powers of ten instead of
+ *          dividing, and transmits them with a single bulk write().
+ * @note Does not print leading zeros.
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint8_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal(n, buffer));
+}
+
+/**
+ * @brief Prints an unsigned 16-bit integer as ASCII digits.
+ * @param n The uint16_t value to be printed (range 0-65535).
+ * @details Renders the digits into a stack buffer with `NumberFormatter::decimal()`, which subtracts powers of ten instead of
+ *          dividing, and transmits them with a single bulk write().
+ * @note Does not print leading zeros.
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint16_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal(n, buffer));
+}
+
+/**
+ * @brief Prints an unsigned 32-bit integer as ASCII digits.
+ * @param n The uint32_t value to be printed (range 0-4294967295).
+ * @details Renders the digits into a stack buffer with `NumberFormatter::decimal()`, which subtracts powers of ten instead of
+ *          dividing (no 32-bit software division), and transmits them with a single bulk write().
+ * @note Does not print leading zeros.
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint32_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal(n, buffer));
+}
+
+/**
+ * @brief Prints a signed 8-bit integer as ASCII digits.
+ * @param n The int8_t value to be printed (range -128 to 127).
+ * @details Renders the minus sign and the digits into one stack buffer and transmits them with a single bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const int8_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal((const int32_t)n, buffer));
+}
+
+/**
+ * @brief Prints a signed 16-bit integer as ASCII digits.
+ * @param n The int16_t value to be printed (range -32768 to 32767).
+ * @details Renders the minus sign and the digits into one stack buffer and transmits them with a single bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const int16_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal((const int32_t)n, buffer));
+}
+
+/**
+ * @brief Prints a signed 32-bit integer as ASCII digits.
+ * @param n The int32_t value to be printed (range -2,147,483,648 to 2,147,483,647).
+ * @details Renders the minus sign and the digits into one stack buffer and transmits them with a single bulk write().
+ *          The edge case of INT32_MIN is handled by `NumberFormatter::decimal()`.
+ */
+template <class SINK>
+void Printer<SINK>::print(const int32_t n)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::decimal(n, buffer));
+}
+
+/**
+ * @brief Prints an unsigned 8-bit integer in the given base.
+ * @param n The uint8_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details Renders the digits with `NumberFormatter::radix()` (shifts only for `BIN`, `OCT` and `HEX`), pads them and
+ *          transmits them with a single bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint8_t n, const uint8_t base, const uint8_t width)
+{
+    this->printRadix(n, base, width);
+}
+
+/**
+ * @brief Prints an unsigned 16-bit integer in the given base.
+ * @param n The uint16_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details Renders the digits with `NumberFormatter::radix()` (shifts only for `BIN`, `OCT` and `HEX`), pads them and
+ *          transmits them with a single bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint16_t n, const uint8_t base, const uint8_t width)
+{
+    this->printRadix(n, base, width);
+}
+
+/**
+ * @brief Prints an unsigned 32-bit integer in the given base.
+ * @param n The uint32_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details Renders the digits with `NumberFormatter::radix()` (shifts only for `BIN`, `OCT` and `HEX`), pads them and
+ *          transmits them with a single bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::print(const uint32_t n, const uint8_t base, const uint8_t width)
+{
+    this->printRadix(n, base, width);
+}
+
+/**
+ * @brief Prints a signed 8-bit integer in the given base.
+ * @param n The int8_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details In decimal the value is printed with its sign. In other bases the two's complement bits of the int8_t are
+ *          printed, e.g. `print((int8_t)-1, HEX)` prints "FF".
+ */
+template <class SINK>
+void Printer<SINK>::print(const int8_t n, const uint8_t base, const uint8_t width)
+{
+    if (base == DEC)
+        this->printDecimal(n, width);
+    else
+        this->printRadix((const uint8_t)n, base, width); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints a signed 16-bit integer in the given base.
+ * @param n The int16_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details In decimal the value is printed with its sign. In other bases the two's complement bits of the int16_t are
+ *          printed, e.g. `print((int16_t)-1, HEX)` prints "FFFF".
+ */
+template <class SINK>
+void Printer<SINK>::print(const int16_t n, const uint8_t base, const uint8_t width)
+{
+    if (base == DEC)
+        this->printDecimal(n, width);
+    else
+        this->printRadix((const uint16_t)n, base, width); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints a signed 32-bit integer in the given base.
+ * @param n The int32_t value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ * @details In decimal the value is printed with its sign. In other bases the two's complement bits of the int32_t are
+ *          printed, e.g. `print((int32_t)-1, HEX)` prints "FFFFFFFF".
+ */
+template <class SINK>
+void Printer<SINK>::print(const int32_t n, const uint8_t base, const uint8_t width)
+{
+    if (base == DEC)
+        this->printDecimal(n, width);
+    else
+        this->printRadix((const uint32_t)n, base, width); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints a fixed-point value, e.g. `printFixed(-1234, 2)` prints "-12.34".
+ * @param n The value, scaled by 10^decimals.
+ * @param decimals The number of fractional digits (0 to 10).
+ * @details Rendered by `NumberFormatter::fixed()` without floating point code or `sprintf()`, then transmitted with a single
+ *          bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::printFixed(const int32_t n, const uint8_t decimals)
+{
+    char buffer[NUMBER_FORMATTER_RADIX_BUFFER_SIZE];
+    this->sink().write((const uint8_t*)buffer, NumberFormatter::fixed(n, decimals, buffer));
+}
+
+/**
+ * @brief Prints a formatted string without avr-libc's vfprintf.
+ * @param format Reference to a FlashStringHelper object containing the format string in program memory, e.g. `F("t=%u v=%d\n")`.
+ * @param args The values of the conversions.
+ * @details The literal parts of the format string are streamed from flash with `printFlash()` and every argument is
+ *          dispatched at compile time to the matching `print()` overload, so a whole log line costs a single call.
+ *          The supported grammar is `%[-|0][width][h|hh|l|ll|z]conversion` with the conversions `%d`, `%i`, `%u`, `%x`, `%X`,
+ *          `%o`, `%b`, `%c` and `%s`, plus `%%`. As in C, numbers are padded to the width with spaces (`%4d`), with zeros
+ *          after the `0` flag (`%04x`) or left justified after the `-` flag (`%-4d`). The length modifiers are skipped and
+ *          the width of `%c`/`%s` is ignored. The C++ type of the argument decides how it is printed, the conversion only
+ *          selects the base.
+ */
+template <class SINK>
+template <class... ARGS>
+void Printer<SINK>::printf(const FlashStringHelper &format, const ARGS&... args)
+{
+    this->printfNext(format.get(), args...);
+}
+
+/**
+ * @brief Prints a newline character.
+ * @details Sends the newline character ('\n') with the sink's write().
+ *          This moves the cursor to the beginning of the next line 
+ *          in terminal displays or serial monitors.
+ * @note Some systems may require an additional carriage return ('\r') 
+ *       for proper line formatting (e.g., "\r\n").
+ */
+template <class SINK>
+void Printer<SINK>::println(void)
+{
+    this->sink().write((const uint8_t)'\n');
+}
+
+/**
+ * @brief Prints a value followed by a newline ('\n').
+ * @param n Any value accepted by `print()`.
+ * @details A single template replaces one `println()` body per type, each instantiation is a call to the matching `print()`
+ *          overload followed by `println()`.
+ */
+template <class SINK>
+template <class T>
+void Printer<SINK>::println(const T& n)
+{
+    this->print(n);
+    this->println();
+}
+
+/**
+ * @brief Prints an integer in the given base followed by a newline ('\n').
+ * @param n The value to be printed.
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`.
+ * @param width Minimum number of digits, padded with leading zeros (0 for none).
+ */
+template <class SINK>
+template <class T>
+void Printer<SINK>::println(const T& n, const uint8_t base, const uint8_t width)
+{
+    this->print(n, base, width);
+    this->println();
+}
+
+/**
+ * @brief Prints a fixed-point value followed by a newline.
+ * @param n The value, scaled by 10^decimals.
+ * @param decimals The number of fractional digits (0 to 10).
+ */
+template <class SINK>
+void Printer<SINK>::printlnFixed(const int32_t n, const uint8_t decimals)
+{
+    this->printFixed(n, decimals);
+    this->println();
+}
+
+
+/**
+ * @brief Streams a string from program memory to the sink, in chunks copied through a stack buffer
+ * @param s Pointer to the string in program memory, advanced to the null terminator or to `stop`
+ * @param stop Character ending the string besides the null terminator (0 for none)
+ * @details Each chunk of up to `PRINTER_FLASH_CHUNK_SIZE` characters is handed to the sink with one bulk write().
+ */
+template <class SINK>
+void Printer<SINK>::printFlash(const char** s, const char stop)
+{
+    char buffer[PRINTER_FLASH_CHUNK_SIZE];
+    const char* ptr = *s;
+    for (;;)
+    {
+        uint8_t i = 0;
+        while (i < sizeof(buffer))
+        {
+            const char c = (char)pgm_read_byte(ptr);
+            if (!c || c == stop)
+                break;
+            buffer[i++] = c;
+            ptr++;
+        }
+        if (i)
+            this->sink().write((const uint8_t*)buffer, i);
+        if (i < sizeof(buffer))
+            break;
+    }
+    *s = ptr;
+}
+
+/**
+ * @brief Returns the sink deriving from this printer
+ * @return Reference to the sink
+ */
+template <class SINK>
+inline SINK& Printer<SINK>::sink(void)
+{
+    return (static_cast<SINK&>(*this));
+}
+
+/**
+ * @brief Prints the literal part of a printf format string, up to its next conversion
+ * @param format Pointer to the format string in program memory, advanced past the conversion
+ * @param base Set to the base of the conversion: `DEC` for `%d`, `%i` and `%u`, `HEX` for `%x` and `%X`, `OCT` for `%o`,
+ *             `BIN` for `%b`
+ * @param width Set to the minimum width of the conversion, e.g. 4 for `%04x` or `%4x`
+ * @param fill Set to the padding of the conversion: '0' for `%04x`, ' ' for `%4x`, '-' for `%-4x`
+ * @return 1 if a conversion was found, 0 once the end of the format string has been reached
+ * @details Parses `%[-|0][width][h|hh|l|ll|z]conversion`, `%%` prints a single '%'. The length modifiers are skipped. The
+ *          type of the argument decides how it is printed (`%c` and `%s` only document the intent), the conversion only
+ *          selects the base, the width and the padding.
+ */
+template <class SINK>
+const uint8_t Printer<SINK>::printfLiteral(const char** format, uint8_t* base, uint8_t* width, char* fill)
+{
+    for (;;)
+    {
+        this->sink().printFlash(format, '%');
+        if (!pgm_read_byte(*format))
+            return (0);
+
+        char c = (char)pgm_read_byte(++(*format)); /*!< Skip the '%' */
+        if (c == '%')
+        {
+            (*format)++;
+            this->sink().write((const uint8_t)'%');
+            continue;
+        }
+
+        *fill = ' ';
+        if (c == '-' || c == '0')
+        {
+            *fill = c;
+            c = (char)pgm_read_byte(++(*format));
+        }
+        *width = 0;
+        while (c >= '0' && c <= '9')
+        {
+            *width = (uint8_t)(*width * 10 + (c - '0'));
+            c = (char)pgm_read_byte(++(*format));
+        }
+        while (c == 'h' || c == 'l' || c == 'z')
+            c = (char)pgm_read_byte(++(*format)); /*!< Skip the length modifiers */
+        if (!c)
+            return (0); /*!< Truncated conversion */
+        (*format)++;
+
+        switch (c)
+        {
+            case 'x': case 'X': *base = HEX; break;
+            case 'o':           *base = OCT; break;
+            case 'b':           *base = BIN; break;
+            default:            *base = DEC; break;
+        }
+        return (1);
+    }
+}
+
+/**
+ * @brief Prints the rest of a printf format string once every argument has been consumed
+ * @param format Pointer to the format string in program memory
+ * @details Conversions left without an argument print nothing.
+ */
+template <class SINK>
+void Printer<SINK>::printfNext(const char* format)
+{
+    uint8_t base, width;
+    char fill;
+    while (this->printfLiteral(&format, &base, &width, &fill));
+}
+
+/**
+ * @brief Prints the next literal part of a printf format string and the argument of its conversion
+ * @param format Pointer to the format string in program memory
+ * @param arg The argument of the next conversion
+ * @param args The remaining arguments
+ * @details Recurses once per argument at compile time, so each argument is dispatched to the matching `print()` overload
+ *          without any `va_list`. Arguments left without a conversion are ignored.
+ */
+template <class SINK>
+template <class T, class... ARGS>
+void Printer<SINK>::printfNext(const char* format, const T& arg, const ARGS&... args)
+{
+    uint8_t base, width;
+    char fill;
+    if (!this->printfLiteral(&format, &base, &width, &fill))
+        return;
+    this->printfArg(arg, base, width, fill);
+    this->printfNext(format, args...);
+}
+
+/**
+ * @brief Prints a printf character argument
+ * @param c The character
+ * @param base Ignored
+ * @param width Ignored
+ * @param fill Ignored
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const char c, const uint8_t base, const uint8_t width, const char fill)
+{
+    (void)base;
+    (void)width;
+    (void)fill;
+    this->print(c);
+}
+
+/**
+ * @brief Prints a printf string argument stored in RAM
+ * @param s The null-terminated string
+ * @param base Ignored
+ * @param width Ignored
+ * @param fill Ignored
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const char* s, const uint8_t base, const uint8_t width, const char fill)
+{
+    (void)base;
+    (void)width;
+    (void)fill;
+    this->print(s);
+}
+
+/**
+ * @brief Prints a printf string argument stored in program memory
+ * @param s Reference to a FlashStringHelper object containing the string in program memory
+ * @param base Ignored
+ * @param width Ignored
+ * @param fill Ignored
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const FlashStringHelper &s, const uint8_t base, const uint8_t width, const char fill)
+{
+    (void)base;
+    (void)width;
+    (void)fill;
+    this->print(s);
+}
+
+/**
+ * @brief Prints a printf unsigned 8-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const uint8_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    this->printRadix(n, base, width, fill);
+}
+
+/**
+ * @brief Prints a printf unsigned 16-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const uint16_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    this->printRadix(n, base, width, fill);
+}
+
+/**
+ * @brief Prints a printf unsigned 32-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const uint32_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    this->printRadix(n, base, width, fill);
+}
+
+/**
+ * @brief Prints a printf signed 8-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const int8_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    if (base == DEC)
+        this->printDecimal(n, width, fill);
+    else
+        this->printRadix((const uint8_t)n, base, width, fill); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints a printf signed 16-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const int16_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    if (base == DEC)
+        this->printDecimal(n, width, fill);
+    else
+        this->printRadix((const uint16_t)n, base, width, fill); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints a printf signed 32-bit integer argument
+ * @param n The value
+ * @param base The base of the conversion
+ * @param width The minimum width of the conversion
+ * @param fill The padding of the conversion: '0', ' ' or '-' (left justified)
+ */
+template <class SINK>
+void Printer<SINK>::printfArg(const int32_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    if (base == DEC)
+        this->printDecimal(n, width, fill);
+    else
+        this->printRadix((const uint32_t)n, base, width, fill); /*!< Two's complement digits in other bases */
+}
+
+/**
+ * @brief Prints an unsigned value in the given base, padded to a minimum width
+ * @param n The value to be printed
+ * @param base `BIN`, `OCT`, `DEC` or `HEX`
+ * @param width Minimum number of digits
+ * @param fill '0' for leading zeros, ' ' for leading spaces, '-' for trailing spaces
+ */
+template <class SINK>
+void Printer<SINK>::printRadix(const uint32_t n, const uint8_t base, const uint8_t width, const char fill)
+{
+    char buffer[NUMBER_FORMATTER_RADIX_BUFFER_SIZE];
+    this->printPadded(buffer, NumberFormatter::radix(n, base, buffer), width, fill);
+}
+
+/**
+ * @brief Prints a signed value in decimal, padded to a minimum width
+ * @param n The value to be printed
+ * @param width Minimum number of characters, sign included
+ * @param fill '0' for zeros after the sign, ' ' for leading spaces, '-' for trailing spaces
+ */
+template <class SINK>
+void Printer<SINK>::printDecimal(const int32_t n, const uint8_t width, const char fill)
+{
+    char buffer[NUMBER_FORMATTER_RADIX_BUFFER_SIZE];
+    this->printPadded(buffer, NumberFormatter::decimal(n, buffer), width, fill);
+}
+
+/**
+ * @brief Sends a rendered number padded to a minimum width
+ * @param buffer The rendered number, at least `NUMBER_FORMATTER_RADIX_BUFFER_SIZE` bytes
+ * @param length The number of characters in `buffer`
+ * @param width Minimum number of characters
+ * @param fill '0' for zeros after the sign, ' ' for leading spaces, '-' for trailing spaces
+ * @details Zeros are inserted into the buffer by `NumberFormatter::pad()`, spaces are written around it.
+ */
+template <class SINK>
+void Printer<SINK>::printPadded(char* buffer, const uint8_t length, const uint8_t width, const char fill)
+{
+    if (fill == '0')
+    {
+        this->sink().write((const uint8_t*)buffer, NumberFormatter::pad(buffer, length, width));
+        return;
+    }
+
+    const uint8_t spaces = (width > length) ? (uint8_t)(width - length) : 0;
+    if (fill == ' ')
+        for (uint8_t i = 0; i < spaces; i++)
+            this->sink().write((const uint8_t)' ');
+    this->sink().write((const uint8_t*)buffer, length);
+    if (fill == '-')
+        for (uint8_t i = 0; i < spaces; i++)
+            this->sink().write((const uint8_t)' ');
+}
@@ -4,64 +4,276 @@
 /* Dependencies */
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include <avr/io.h>
 #include <avr/interrupt.h> 
 #include <util/atomic.h>
+#include <util/delay.h>
+#include <avr/sleep.h>
 #include "FlashStringHelper.h"
+#include "Printer.h"
+#include "UARTPort.h"
+#include "UARTBaud.h"
+#include "UARTConfig.h"
 
 /**
- * @brief Size of the UART receive buffer.
- * @details This macro defines the size of the buffer used to store incoming UART data. The buffer is used to hold data received 
+ * @brief Default size of the UART receive buffer.
+ * @details This macro defines the default size of the buffer used to store incoming UART data. The buffer is used to hold data received 
  *          over UART before it is processed. A size of 64 bytes is chosen, but this can be adjusted as needed.
- * @note The size is defined as a constant `uint8_t` value.
+ * @note The size must be a power of two between 2 and 256, so the circular indexes can wrap with a single AND.
  */
-#define UART_RX_BUFFER_SIZE (const uint8_t)64 /**< Size of the UART receive buffer */
+#ifndef UART_RX_BUFFER_SIZE
+#define UART_RX_BUFFER_SIZE (const uint16_t)64 /**< Size of the UART receive buffer */
+#endif
 
 /**
- * @brief Size of the UART transmit buffer.
- * @details This macro defines the size of the buffer used to store outgoing UART data before it is transmitted. The buffer
+ * @brief Default size of the UART transmit buffer.
+ * @details This macro defines the default size of the buffer used to store outgoing UART data before it is transmitted. The buffer
  *          holds data that needs to be sent over UART. A size of 64 bytes is chosen, but this can be adjusted based on application needs.
- * @note The size is defined as a constant `uint8_t` value.
+ * @note The size must be a power of two between 2 and 256, so the circular indexes can wrap with a single AND.
+ */
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE (const uint16_t)64 /**< Size of the UART transmit buffer */
+#endif
+
+/**
+ * @brief Per port buffer sizes.
+ * @details Each port instance can override the default sizes, e.g. a 256 byte receive buffer on a busy GPS/modem link and a
+ *          16 byte one on an idle debug console. Define them at project level (e.g. `-DUART1_RX_BUFFER_SIZE=256`).
+ *          A size of 0 builds the port without that direction: the ring is dropped, `begin()` leaves the receiver (RXEN, RXCIE)
+ *          or the transmitter (TXEN) disabled so its pin stays a GPIO, and using the missing direction fails to compile
+ *          (e.g. `-DUART0_RX_BUFFER_SIZE=0` for a log-only console, `-DUART1_TX_BUFFER_SIZE=0` for a GPS receiver).
+ */
+#ifndef UART0_RX_BUFFER_SIZE
+#define UART0_RX_BUFFER_SIZE UART_RX_BUFFER_SIZE /**< Size of the UART bus 0 receive buffer */
+#endif
+#ifndef UART0_TX_BUFFER_SIZE
+#define UART0_TX_BUFFER_SIZE UART_TX_BUFFER_SIZE /**< Size of the UART bus 0 transmit buffer */
+#endif
+#ifndef UART1_RX_BUFFER_SIZE
+#define UART1_RX_BUFFER_SIZE UART_RX_BUFFER_SIZE /**< Size of the UART bus 1 receive buffer */
+#endif
+#ifndef UART1_TX_BUFFER_SIZE
+#define UART1_TX_BUFFER_SIZE UART_TX_BUFFER_SIZE /**< Size of the UART bus 1 transmit buffer */
+#endif
+#ifndef UART2_RX_BUFFER_SIZE
+#define UART2_RX_BUFFER_SIZE UART_RX_BUFFER_SIZE /**< Size of the UART bus 2 receive buffer */
+#endif
+#ifndef UART2_TX_BUFFER_SIZE
+#define UART2_TX_BUFFER_SIZE UART_TX_BUFFER_SIZE /**< Size of the UART bus 2 transmit buffer */
+#endif
+#ifndef UART3_RX_BUFFER_SIZE
+#define UART3_RX_BUFFER_SIZE UART_RX_BUFFER_SIZE /**< Size of the UART bus 3 receive buffer */
+#endif
+#ifndef UART3_TX_BUFFER_SIZE
+#define UART3_TX_BUFFER_SIZE UART_TX_BUFFER_SIZE /**< Size of the UART bus 3 transmit buffer */
+#endif
+
+/**
+ * @brief Frame formats accepted by `begin()`: data bits, parity (None, Even, Odd) and stop bits.
+ * @details The values are the UCSRC bits of the format (UPM, USBS, UCSZ1:0). Bit 7 (UMSEL01, always 0 in asynchronous mode)
+ *          flags the 9-bit formats, which also set UCSZ02 in UCSRB. Parity errors are counted in `UARTStats::parity`.
+ */
+#define UART_5N1 (const uint8_t)0x00
+#define UART_5N2 (const uint8_t)0x08
+#define UART_5E1 (const uint8_t)0x20
+#define UART_5E2 (const uint8_t)0x28
+#define UART_5O1 (const uint8_t)0x30
+#define UART_5O2 (const uint8_t)0x38
+#define UART_6N1 (const uint8_t)0x02
+#define UART_6N2 (const uint8_t)0x0A
+#define UART_6E1 (const uint8_t)0x22
+#define UART_6E2 (const uint8_t)0x2A
+#define UART_6O1 (const uint8_t)0x32
+#define UART_6O2 (const uint8_t)0x3A
+#define UART_7N1 (const uint8_t)0x04
+#define UART_7N2 (const uint8_t)0x0C
+#define UART_7E1 (const uint8_t)0x24
+#define UART_7E2 (const uint8_t)0x2C
+#define UART_7O1 (const uint8_t)0x34
+#define UART_7O2 (const uint8_t)0x3C
+#define UART_8N1 (const uint8_t)0x06
+#define UART_8N2 (const uint8_t)0x0E
+#define UART_8E1 (const uint8_t)0x26
+#define UART_8E2 (const uint8_t)0x2E
+#define UART_8O1 (const uint8_t)0x36
+#define UART_8O2 (const uint8_t)0x3E
+#define UART_9N1 (const uint8_t)0x86
+#define UART_9N2 (const uint8_t)0x8E
+#define UART_9E1 (const uint8_t)0xA6
+#define UART_9E2 (const uint8_t)0xAE
+#define UART_9O1 (const uint8_t)0xB6
+#define UART_9O2 (const uint8_t)0xBE
+#define UART_CONFIG_9BIT (const uint8_t)0x80 /**< Flag of the 9-bit formats */
+
+/**
+ * @brief Master SPI modes accepted by `beginSPI()`, see `UART_ENABLE_MSPIM`.
+ * @details The values are the UCSRC bits of the mode (UCPOL, UCPHA), `UART_SPI_LSB_FIRST` (UDORD) can be or-ed with any of them.
+ */
+#define UART_SPI_MODE0     (const uint8_t)0x00 /**< Clock idle low, sample on the leading edge */
+#define UART_SPI_MODE1     (const uint8_t)0x02 /**< Clock idle low, sample on the trailing edge */
+#define UART_SPI_MODE2     (const uint8_t)0x01 /**< Clock idle high, sample on the leading edge */
+#define UART_SPI_MODE3     (const uint8_t)0x03 /**< Clock idle high, sample on the trailing edge */
+#define UART_SPI_LSB_FIRST (const uint8_t)0x04 /**< Least significant bit first */
+
+/**
+ * @brief Largest baud rate error accepted by `begin<BAUD>()`, in hundredths of a percent.
+ * @details The compile-time `begin<BAUD>()` refuses to build when the closest achievable rate is further away. 2.5 % leaves
+ *          margin against the roughly 4 % total mismatch an 8N1 frame tolerates, and still accepts 115200 at 16 MHz (+2.12 %).
+ */
+#ifndef UART_BAUD_ERROR_MAX
+#define UART_BAUD_ERROR_MAX 250
+#endif
+
+/**
+ * @brief Hooks of the interrupt vectors, see `UART_ENABLE_ISR_TRACE`.
+ */
+#if UART_ENABLE_ISR_TRACE
+#define UART_TRACE_ENTER(bit) (UART_TRACE_PORT |= (1 << (bit)))
+#define UART_TRACE_EXIT(bit)  (UART_TRACE_PORT &= ~(1 << (bit)))
+#else
+#define UART_TRACE_ENTER(bit)
+#define UART_TRACE_EXIT(bit)
+#endif
+
+/**
+ * @brief Software flow control characters, see `UART_ENABLE_XON_XOFF`.
+ */
+#define UART_XON  (const uint8_t)0x11 /**< DC1, resume transmission */
+#define UART_XOFF (const uint8_t)0x13 /**< DC3, pause transmission */
+
+/**
+ * @brief Receive callback invoked from `isrRX()` with every received byte.
+ * @details Returns non-zero to store the byte in the receive buffer, 0 to skip it (the byte has been fully handled).
+ *          Runs in interrupt context, it must be short and must not wait for the UART.
+ */
+typedef uint8_t (*UARTRxCallback)(const uint8_t byte);
+
+/**
+ * @brief Transmit buffer overflow policies.
+ * @details Select what the blocking `write()` and every `print()`/`println()` do when the transmit buffer is full.
+ *          - `UART_OVERFLOW_BLOCK`: wait until `isrUDRE()` frees space (default).
+ *          - `UART_OVERFLOW_DROP_NEWEST`: discard the bytes that do not fit.
+ *          - `UART_OVERFLOW_DROP_OLDEST`: discard the oldest queued bytes to make room for the new ones.
+ */
+#define UART_OVERFLOW_BLOCK       (const uint8_t)0 /**< Wait for free space */
+#define UART_OVERFLOW_DROP_NEWEST (const uint8_t)1 /**< Discard the new bytes */
+#define UART_OVERFLOW_DROP_OLDEST (const uint8_t)2 /**< Discard the oldest queued bytes */
+
+/**
+ * @brief Receive error counters of a UART port.
+ * @details Filled by `isrRX()` and returned by `__UART__::stats()`. They tell apart data lost on the line (hardware overrun,
+ *          framing and parity errors) from data lost because the consumer is too slow (software ring overflow).
+ */
+struct UARTStats
+{
+    uint16_t overrun;   /**< Hardware data overruns (DOR), bytes lost because `isrRX()` ran too late */
+    uint16_t framing;   /**< Framing errors (FE), invalid stop bit */
+    uint16_t parity;    /**< Parity errors (UPE) */
+    uint16_t overflow;  /**< Bytes discarded because the receive buffer was full */
+    uint8_t  highWater; /**< Highest receive buffer fill level seen */
+};
+
+/**
+ * @brief Transfer queued by `__UART__::transfer()` in Master SPI mode.
  */
-#define UART_TX_BUFFER_SIZE (const uint8_t)64 /**< Size of the UART transmit buffer */
+struct UARTTransfer
+{
+    const uint8_t* tx; /**< Bytes to send, NULL to send 0xFF */
+    uint8_t* rx;       /**< Destination of the received bytes, NULL to discard them */
+    uint16_t size;     /**< Number of bytes to exchange */
+};
 
 /**
  * @brief UART class to control UART communication.
+ * @tparam PORT    Compile-time register descriptor of the USART peripheral (e.g. `__UART0_PORT__`), see `UARTPort.h`.
+ * @tparam RX_SIZE Size of the receive buffer, a power of two between 2 and 256, or 0 for a transmit-only port.
+ * @tparam TX_SIZE Size of the transmit buffer, a power of two between 2 and 256, or 0 for a receive-only port.
+ * @details The `print()`, `println()` and `printf()` family is inherited from `Printer`, which formats into the bulk `write()`
+ *          and streams flash strings with `printFlash()`.
  */
-class __UART__
+template <class PORT, uint16_t RX_SIZE = UART_RX_BUFFER_SIZE, uint16_t TX_SIZE = UART_TX_BUFFER_SIZE>
+class __UART__ : public Printer<__UART__<PORT, RX_SIZE, TX_SIZE> >
 {
+    friend class Printer<__UART__>;
+
+    #if UART_ENABLE_IDLE_DETECT
+    static_assert(UART_IDLE_FRAME_QUEUE_SIZE >= 2 && UART_IDLE_FRAME_QUEUE_SIZE <= 128 && !(UART_IDLE_FRAME_QUEUE_SIZE & (UART_IDLE_FRAME_QUEUE_SIZE - 1)), "UART idle frame queue size must be a power of two");
+    #endif
+    #if UART_ENABLE_URGENT_TX
+    static_assert(UART_URGENT_QUEUE_SIZE >= 1 && UART_URGENT_QUEUE_SIZE <= 8 && !(UART_URGENT_QUEUE_SIZE & (UART_URGENT_QUEUE_SIZE - 1)), "UART urgent queue size must be a power of two between 1 and 8");
+    #endif
+    static_assert(RX_SIZE == 0 || (RX_SIZE >= 2 && RX_SIZE <= 256 && !(RX_SIZE & (RX_SIZE - 1))), "UART RX buffer size must be 0 or a power of two between 2 and 256");
+    static_assert(TX_SIZE == 0 || (TX_SIZE >= 2 && TX_SIZE <= 256 && !(TX_SIZE & (TX_SIZE - 1))), "UART TX buffer size must be 0 or a power of two between 2 and 256");
+    static_assert(RX_SIZE || TX_SIZE, "UART port needs a receive or a transmit buffer");
+
     public:
         /**
-         * @brief Constructor: Initializes the UART control, status, and data registers
-         * @param ubrrh Pointer to the UART baud rate register high
-         * @param ubrrl Pointer to the UART baud rate register low
-         * @param ucsra Pointer to the UART control and status register A
-         * @param ucsrb Pointer to the UART control and status register B
-         * @param ucsrc Pointer to the UART control and status register C
-         * @param udr   Pointer to the UART data register
+         * @brief Begins UART communication by setting the appropriate bits in the control registers
+         * @param baudrate The baud rate to set
+         * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+         * @return 1 if successful, 0 otherwise
          */
-        __UART__(volatile uint8_t* ubrrh, \
-                 volatile uint8_t* ubrrl, \
-                 volatile uint8_t* ucsra, \
-                 volatile uint8_t* ucsrb, \
-                 volatile uint8_t* ucsrc, \
-                 volatile uint8_t* udr);
+        const uint8_t begin(const uint32_t baudrate, const uint8_t config = UART_8N1);
 
         /**
-         * @brief Destructor: Resets the register pointers to NULL
+         * @brief Begins UART communication with a baud rate solved at compile time
+         * @tparam BAUD The baud rate to set
+         * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+         * @return 1 if successful, 0 otherwise
          */
-        ~__UART__();
+        template <uint32_t BAUD>
+        const uint8_t begin(const uint8_t config = UART_8N1);
 
         /**
-         * @brief Begins UART communication by setting the appropriate bits in the control registers
+         * @brief Begins a transmit-only UART communication, the RX pin is left to GPIO
+         * @param baudrate The baud rate to set
+         * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+         * @return 1 if successful, 0 otherwise
+         */
+        const uint8_t beginTx(const uint32_t baudrate, const uint8_t config = UART_8N1);
+
+        /**
+         * @brief Begins a receive-only UART communication, the TX pin is left to GPIO
          * @param baudrate The baud rate to set
+         * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
          * @return 1 if successful, 0 otherwise
          */
-        const uint8_t begin(const uint32_t baudrate);
+        const uint8_t beginRx(const uint32_t baudrate, const uint8_t config = UART_8N1);
+
+        #if UART_ENABLE_MSPIM
+        /**
+         * @brief Begins a Master SPI mode communication, XCK must already be configured as an output
+         * @param bitrate The highest acceptable SPI clock
+         * @param mode The SPI mode (`UART_SPI_MODE0` ... `UART_SPI_MODE3`), optionally or-ed with `UART_SPI_LSB_FIRST`
+         * @return 1 if successful, 0 otherwise
+         */
+        const uint8_t beginSPI(const uint32_t bitrate, const uint8_t mode = UART_SPI_MODE0);
+
+        /**
+         * @brief Queues a full duplex transfer run in the background, waiting while two transfers are already queued
+         * @param tx Bytes to send, NULL to send 0xFF
+         * @param rx Destination of the received bytes, NULL to discard them
+         * @param size Number of bytes to exchange
+         */
+        void transfer(const uint8_t* tx, uint8_t* rx, const uint16_t size);
+
+        /**
+         * @brief Returns the number of transfers queued or running
+         * @return 0 once every queued transfer has completed, up to 2
+         */
+        const uint8_t transferPending(void);
+        #endif
+
+        /**
+         * @brief Returns the error of the configured baud rate
+         * @return The error of the achieved rate in hundredths of a percent (e.g. 212 for +2.12 %), 0 before `begin()`
+         */
+        const int16_t baudError(void);
 
         /**
          * @brief Checks if data is available to read
-         * @return 1 if data is available, 0 otherwise
+         * @return The number of bytes in the receive buffer, 0 if none
          */
         const uint8_t available(void);
 
@@ -76,6 +288,12 @@ class __UART__
          */
         const uint8_t isTransmitting(void);
 
+        /**
+         * @brief Waits until every queued byte, stop bit included, has been transmitted
+         * @note Blocks while the peer holds XOFF or deasserts CTS.
+         */
+        void flushTx(void);
+
         /**
          * @brief Reads a single byte from the receive buffer
          * @return The byte read
@@ -96,6 +314,163 @@ class __UART__
          */
         void read(void* n, const uint8_t size);
 
+        /**
+         * @brief Reads every byte currently in the receive buffer, up to a maximum length, without blocking
+         * @param n Pointer to the byte array
+         * @param size The size of the byte array
+         * @return The number of bytes read
+         */
+        const uint8_t readAvailable(uint8_t* n, const uint8_t size);
+
+        /**
+         * @brief Reads bytes from the receive buffer into a generic pointer, without blocking
+         * @param n Pointer to the destination memory location
+         * @param size The maximum number of bytes to read
+         * @return The number of bytes read
+         */
+        const uint8_t readAvailable(void* n, const uint8_t size);
+
+        /**
+         * @brief Reads a byte array from the receive buffer, giving up when the line stays idle
+         * @param n Pointer to the byte array
+         * @param size The size of the byte array
+         * @param ticks The timeout in ticks of about 1 microsecond, restarted every time new data arrives
+         * @return The number of bytes read
+         */
+        const uint8_t readTimeout(uint8_t* n, const uint8_t size, const uint16_t ticks);
+
+        /**
+         * @brief Borrows the longest contiguous run of received data directly inside the receive buffer
+         * @param p Set to the first unread byte inside `rxBuffer`
+         * @return The number of bytes readable at `*p`
+         */
+        const uint8_t peekSpan(const uint8_t** p);
+
+        /**
+         * @brief Releases bytes borrowed with `peekSpan()`
+         * @param size The number of bytes to release
+         */
+        void consume(uint8_t size);
+
+        #if UART_ENABLE_RX_CALLBACK
+        /**
+         * @brief Registers the function invoked from `isrRX()` with every received byte
+         * @param callback The function, NULL to remove it
+         */
+        void setRxCallback(const UARTRxCallback callback);
+        #endif
+
+        #if UART_ENABLE_IDLE_DETECT
+        /**
+         * @brief Sets the silence closing a frame
+         * @param ticks The number of `tick()` calls without reception ending a frame (e.g. 4 for Modbus-RTU when ticking once
+         *              per character time)
+         */
+        void setIdleTimeout(const uint8_t ticks);
+
+        /**
+         * @brief Advances the idle-line detection, call it periodically (e.g. from a timer interrupt)
+         */
+        void tick(void);
+
+        /**
+         * @brief Returns the length of the oldest complete frame
+         * @return The number of bytes of the frame, 0 if no complete frame is available
+         */
+        const uint8_t frameAvailable(void);
+
+        /**
+         * @brief Reads the oldest complete frame from the receive buffer
+         * @param n Destination
+         * @param size The size of the destination, longer frames are truncated
+         * @return The number of bytes copied, 0 if no complete frame is available
+         */
+        const uint8_t readFrame(uint8_t* n, const uint8_t size);
+        #endif
+
+        #if UART_ENABLE_LINE_MODE
+        /**
+         * @brief Enables line-oriented reception
+         * @param delimiter The character ending a line
+         */
+        void setLineMode(const char delimiter = '\n');
+
+        /**
+         * @brief Returns the number of complete lines in the receive buffer
+         * @return The number of delimiters received and not yet read with `readLine()`
+         */
+        const uint8_t lineAvailable(void);
+
+        /**
+         * @brief Reads one complete line from the receive buffer
+         * @param s Destination, receives the line without its delimiter, null terminated
+         * @param size The size of the destination, longer lines are truncated
+         * @return The number of characters copied, 0 if no complete line is available
+         */
+        const uint8_t readLine(char* s, const uint8_t size);
+        #endif
+
+        #if UART_ENABLE_RS485
+        /**
+         * @brief Enables the RS-485 half-duplex mode
+         * @param port The PORTx register of the driver enable pin (e.g. `&PORTD`), NULL to disable the mode
+         * @param bit The bit of the driver enable pin in `port` (e.g. `PD2`)
+         */
+        void setRS485(volatile uint8_t* port, const uint8_t bit);
+        #endif
+
+        #if UART_ENABLE_MPCM
+        /**
+         * @brief Enables the hardware address filtering, requires a 9-bit frame format
+         * @param address The address of this node
+         */
+        void setAddress(const uint8_t address);
+
+        /**
+         * @brief Disables the hardware address filtering, every frame is received again
+         */
+        void clearAddress(void);
+
+        /**
+         * @brief Transmits an address frame (ninth bit set) selecting the node receiving the following data frames
+         * @param address The address of the node
+         */
+        void writeAddress(const uint8_t address);
+        #endif
+
+        #if UART_ENABLE_FLOW_CONTROL
+        /**
+         * @brief Enables the RTS/CTS hardware flow control, both pins are active low
+         * @param rtsPort The PORTx register of the RTS output (e.g. `&PORTD`), NULL for none
+         * @param rtsBit The bit of the RTS output in `rtsPort`
+         * @param ctsPort The PORTx register of the CTS input (e.g. `&PORTD`), NULL for none
+         * @param ctsBit The bit of the CTS input in `ctsPort`
+         */
+        void setFlowControl(volatile uint8_t* rtsPort, const uint8_t rtsBit, volatile uint8_t* ctsPort, const uint8_t ctsBit);
+
+        /**
+         * @brief Resumes a transmission paused by CTS, call it from the pin change interrupt of the CTS pin
+         */
+        void isrCTS(void);
+        #endif
+
+        #if UART_ENABLE_URGENT_TX
+        /**
+         * @brief Queues a byte sent ahead of the transmit buffer, without blocking
+         * @param n The byte to send
+         * @return 1 if queued, 0 if the urgent queue is full
+         */
+        const uint8_t writeUrgent(const uint8_t n);
+        #endif
+
+        #if UART_ENABLE_XON_XOFF
+        /**
+         * @brief Enables or disables the XON/XOFF software flow control
+         * @param enable 1 to enable, 0 to disable
+         */
+        void setXonXoff(const uint8_t enable);
+        #endif
+
         /**
          * @brief Writes a single byte to the transmit buffer
          * @param n The byte to write
@@ -117,196 +492,212 @@ class __UART__
         void write(const void* n, const uint8_t size);
 
         /**
-         * @brief Prints a single character to the UART.
-         * @param c Character to be transmitted.
+         * @brief Returns the number of bytes that can be written without blocking
+         * @return The free space in the transmit buffer
          */
-        void print(const char c);
+        const uint8_t availableForWrite(void);
 
         /**
-         * @brief Prints a null-terminated string to the UART.
-         * @param s Pointer to the null-terminated string to be transmitted.
+         * @brief Writes as many bytes of a byte array as fit into the transmit buffer, without blocking
+         * @param n Pointer to the byte array
+         * @param size The size of the byte array
+         * @return The number of bytes queued
+         */
+        const uint8_t tryWrite(const uint8_t* n, const uint8_t size);
+
+        /**
+         * @brief Writes as many bytes from a generic pointer as fit into the transmit buffer, without blocking
+         * @param n Pointer to the source memory location
+         * @param size The number of bytes to write
+         * @return The number of bytes queued
          */
-        void print(const char* s);
+        const uint8_t tryWrite(const void* n, const uint8_t size);
 
         /**
-         * @brief Prints a string stored in program memory (Flash) to the UART.
-         * @param s Reference to a FlashStringHelper object containing the string in program memory.
+         * @brief Reserves a contiguous writable span directly inside the transmit buffer
+         * @param p Set to the first free byte inside `txBuffer`
+         * @param size The number of bytes wanted
+         * @return The number of bytes writable at `*p`
          */
-        void print(const FlashStringHelper &s);
+        const uint8_t reserve(uint8_t** p, const uint8_t size);
 
         /**
-         * @brief Prints an unsigned 8-bit integer to the UART as ASCII digits.
-         * @param n The uint8_t value to be printed (range 0-255).
+         * @brief Publishes bytes written into a span obtained with `reserve()` and starts their transmission
+         * @param size The number of bytes written
          */
-        void print(const uint8_t n);
+        void commit(uint8_t size);
 
         /**
-         * @brief Prints an unsigned 16-bit integer to the UART as ASCII digits.
-         * @param n The uint16_t value to be printed (range 0-65535).
+         * @brief Selects what the blocking `write()` and `print()` family do when the transmit buffer is full
+         * @param policy One of `UART_OVERFLOW_BLOCK`, `UART_OVERFLOW_DROP_NEWEST` or `UART_OVERFLOW_DROP_OLDEST`
          */
-        void print(const uint16_t n);
+        void setOverflowPolicy(const uint8_t policy);
 
         /**
-         * @brief Prints an unsigned 32-bit integer to the UART as ASCII digits.
-         * @param n The uint32_t value to be printed (range 0-4294967295).
+         * @brief Disables the UART communication and releases associated resources.
+         * @return Returns 1 if UART was successfully disabled, 0 if UART was not started.
          */
-        void print(const uint32_t n);
+        const uint8_t end(void);
 
         /**
-         * @brief Prints a signed 8-bit integer to the UART as ASCII digits.
-         * @param n The int8_t value to be printed (range -128 to 127).
+         * @brief Returns a snapshot of the receive error counters
+         * @return A copy of the counters
          */
-        void print(const int8_t n);
+        const UARTStats stats(void);
 
         /**
-         * @brief Prints a signed 16-bit integer to the UART as ASCII digits.
-         * @param n The int16_t value to be printed (range -32768 to 32767).
+         * @brief Clears the receive error counters and the high-water mark
          */
-        void print(const int16_t n);
+        void resetStats(void);
 
         /**
-         * @brief Prints a signed 32-bit integer to the UART as ASCII digits.
-         * @param n The int32_t value to be printed (range -2147483648 to 2147483647).
+         * @brief ISR (Interrupt Service Routine) for receiving data on the UART.
          */
-        void print(const int32_t n);
+        void isrRX(void);
 
         /**
-         * @brief Prints a newline character ('\n') to the UART.
+         * @brief ISR (Interrupt Service Routine) for transmitting data on the UART.
          */
-        void println(void);
+        void isrUDRE(void);
 
+        #if UART_ENABLE_RS485
         /**
-         * @brief Prints a single character followed by a newline to the UART.
-         * @param c The character to be printed.
+         * @brief ISR (Interrupt Service Routine) for the end of a transmission on the UART.
          */
-        void println(const char c);
+        void isrTXC(void);
+        #endif
 
+    private:
         /**
-         * @brief Prints a null-terminated string followed by a newline to the UART.
-         * @param s Pointer to the null-terminated string to be transmitted.
+         * @brief Solves the baud rate at runtime and enables the port
+         * @param baudrate The baud rate to set
+         * @param config The frame format
+         * @param enable The UCSRB enable bits (RXEN, RXCIE, TXEN)
+         * @return 1 if successful, 0 otherwise
          */
-        void println(const char* s);
+        const uint8_t open(const uint32_t baudrate, const uint8_t config, const uint8_t enable);
 
         /**
-         * @brief Prints a string stored in program memory (Flash) followed by a newline to the UART.
-         * @param s Reference to a FlashStringHelper object containing the string in program memory.
+         * @brief Programs the baud rate and enables the port
+         * @param ubrr The UBRR value
+         * @param u2x 1 to enable the double speed mode
+         * @param error The error of the achieved rate, returned by `baudError()`
+         * @param config The frame format
+         * @param enable The UCSRB enable bits (RXEN, RXCIE, TXEN)
+         * @return 1 if successful, 0 if already started
          */
-        void println(const FlashStringHelper &s);
+        const uint8_t setup(const uint16_t ubrr, const uint8_t u2x, const int16_t error, const uint8_t config, const uint8_t enable);
 
         /**
-         * @brief Prints an unsigned 8-bit integer followed by a newline to the UART.
-         * @param n The uint8_t value to be printed (range 0 to 255).
+         * @brief Copies as many bytes as fit into the transmit buffer and arms the UDRIE interrupt once.
+         * @param n Pointer to the byte array
+         * @param size The number of bytes to queue
+         * @return The number of bytes queued
          */
-        void println(const uint8_t n);
+        const uint8_t txEnqueue(const uint8_t* n, const uint8_t size);
 
         /**
-         * @brief Prints an unsigned 16-bit integer followed by a newline to the UART.
-         * @param n The uint16_t value to be printed (range 0 to 65535).
+         * @brief Copies bytes out of the receive buffer without consuming them
+         * @param n Destination
+         * @param tail Index of the first byte to copy
+         * @param size The number of bytes to copy, at most the number of bytes in the receive buffer
          */
-        void println(const uint16_t n);
+        void rxCopy(uint8_t* n, const uint8_t tail, const uint8_t size);
 
         /**
-         * @brief Prints an unsigned 32-bit integer followed by a newline to the UART.
-         * @param n The uint32_t value to be printed (range 0 to 4294967295).
+         * @brief Copies a string from program memory into the transmit buffer, up to the free contiguous space
+         * @param s Pointer to the string in program memory, advanced past the queued characters
+         * @param stop Character ending the copy besides the null terminator (0 for none), left unconsumed at `*s`
+         * @return 1 once the null terminator or `stop` has been reached, 0 if the string continues
          */
-        void println(const uint32_t n);
+        const uint8_t txEnqueueFlash(const char** s, const char stop);
 
         /**
-         * @brief Prints a signed 8-bit integer followed by a newline to the UART.
-         * @param n The int8_t value to be printed (range -128 to 127).
+         * @brief Streams a string from program memory into the transmit buffer, applying the overflow policy
+         * @param s Pointer to the string in program memory, advanced to the null terminator or to `stop`
+         * @param stop Character ending the string besides the null terminator (0 for none)
          */
-        void println(const int8_t n);
+        void printFlash(const char** s, const char stop);
 
         /**
-         * @brief Prints an unsigned 16-bit integer followed by a newline to the UART.
-         * @param n The uint16_t value to be printed (range 0 to 65535).
+         * @brief Applies the overflow policy when the transmit buffer is full
+         * @param size The number of bytes waiting to be queued
+         * @return 1 if the caller should retry queueing, 0 if the pending bytes must be discarded
          */
-        void println(const int16_t n);
+        const uint8_t txOverflow(const uint8_t size);
 
         /**
-         * @brief Prints an unsigned 32-bit integer followed by a newline to the UART.
-         * @param n The uint32_t value to be printed (range 0 to 4294967295).
+         * @brief Arms the transmission of newly queued bytes
          */
-        void println(const int32_t n);
+        void txStart(void);
 
         /**
-         * @brief Disables the UART communication and releases associated resources.
-         * @return Returns 1 if UART was successfully disabled, 0 if UART was not started.
+         * @brief Writes a byte to UDR, asserting the RS-485 driver enable pin first
+         * @param byte The byte to transmit
          */
-        const uint8_t end(void);
+        void txSend(const uint8_t byte);
 
         /**
-         * @brief ISR (Interrupt Service Routine) for receiving data on the UART.
+         * @brief Tells whether queued bytes are waiting for `isrUDRE()`
+         * @return 1 while UDRIE is set or the transmission is paused by CTS or XOFF, 0 otherwise
          */
-        void isrRX(void);
+        const uint8_t txBusy(void);
 
         /**
-         * @brief ISR (Interrupt Service Routine) for transmitting data on the UART.
+         * @brief Re-arms a transmission paused by CTS once CTS is asserted again
          */
-        void isrUDRE(void);
+        void txResume(void);
 
-    private:
         /**
-         * @brief Pointer to the UART Baud Rate Register High byte (UBRRH).
-         * @details This pointer refers to the high byte of the UART baud rate register, which is used to set the baud rate for UART communication. 
-         *          The baud rate is determined by both the high and low bytes of the UBRR register (UBRRH and UBRRL).
-         *          This register is used in conjunction with UBRRL to configure the speed of serial communication.
-         * @note The `volatile` keyword indicates that the value of this register can change unexpectedly (such as in hardware operations), 
-         *       so the compiler must not optimize access to it.
+         * @brief Waits for `isrUDRE()` to make progress on the transmit buffer
          */
-        volatile uint8_t* ubrrh; /**< Pointer to the high byte of the UART Baud Rate Register */
+        void txWait(void);
 
+        #if UART_ENABLE_MSPIM
         /**
-         * @brief Pointer to the UART Baud Rate Register Low byte (UBRRL).
-         * @details This pointer refers to the low byte of the UART baud rate register, which is used together with the high byte (UBRRH) 
-         *          to set the baud rate for UART communication. The baud rate is determined by the combined value of UBRRH and UBRRL.
-         *          This register is critical for configuring the speed of the UART serial communication.
-         * @note The `volatile` keyword indicates that the value of this register can be changed unexpectedly (e.g., by hardware or external events),
-         *       so the compiler will not optimize access to it.
+         * @brief Master SPI mode part of `isrRX()`, stores a received byte into the oldest transfer
          */
-        volatile uint8_t* ubrrl; /**< Pointer to the low byte of the UART Baud Rate Register */
+        void spiReceive(void);
 
         /**
-         * @brief Pointer to the USART Control and Status Register A (UCSRA).
-         * @details This pointer refers to the USART control and status register A, which contains various status flags related to UART communication,
-         *          including flags for transmit and receive operations, framing errors, overrun errors, and more.
-         *          This register is used to check the status of UART operations and manage various control settings.
-         * @note The `volatile` keyword ensures that the compiler does not optimize the access to this register, 
-         *       as the register can change at any time due to hardware actions (e.g., data received or transmitted).
+         * @brief Master SPI mode part of `isrUDRE()`, feeds the transmit pipeline from the queued transfers
          */
-        volatile uint8_t* ucsra; /**< Pointer to the USART Control and Status Register A */
+        void spiSend(void);
+        #endif
 
         /**
-         * @brief Pointer to the USART Control and Status Register C (UCSRC).
-         * @details This pointer refers to the USART Control and Status Register C, which is used to configure the frame format, such as
-         *          data bits, parity bits, and stop bits, as well as enabling or disabling certain features (e.g., USART Mode, Asynchronous mode, etc.).
-         * @note The `volatile` keyword ensures that the compiler does not optimize the access to this register, as it can change due to hardware behavior.
+         * @brief Resumes the peer (RTS asserted, XON sent) once the reads brought the receive buffer below the low watermark
          */
-        volatile uint8_t* ucsrc; /**< Pointer to the USART Control and Status Register C */
+        void rxRelease(void);
 
         /**
-         * @brief Pointer to the UART Data Register (UDR).
-         * @details This pointer refers to the UART Data Register, which holds the data to be transmitted or received. Writing to this register
-         *          sends data over the UART, and reading from it retrieves received data.
-         * @note The `volatile` keyword ensures that the compiler does not optimize access to this register, as data can change unexpectedly due to hardware actions.
+         * @brief Masks wrapping the circular buffer indexes.
+         * @details Since the buffer sizes are powers of two, `(index + 1) & MASK` replaces the `% SIZE` modulo operation.
+         *          The mask of a missing direction is 0, which keeps every index on the single placeholder byte of its buffer.
          */
-        volatile uint8_t* udr; /**< Pointer to the UART Data Register */
+        static const uint8_t RX_MASK = (uint8_t)(RX_SIZE ? RX_SIZE - 1 : 0); /**< Receive buffer index mask */
+        static const uint8_t TX_MASK = (uint8_t)(TX_SIZE ? TX_SIZE - 1 : 0); /**< Transmit buffer index mask */
+
+        /**
+         * @brief UCSRB enable bits of the directions the port is built with, used by `begin()`.
+         */
+        static const uint8_t ENABLE = (RX_SIZE ? (1 << RXEN0) | (1 << RXCIE0) : 0) | (TX_SIZE ? (1 << TXEN0) : 0);
 
         /**
          * @brief Buffer for storing received UART data.
          * @details This buffer holds the incoming data received over UART. When data is received, it is placed in this buffer for further processing.
-         *          The buffer size is defined by `UART_RX_BUFFER_SIZE`, and it uses circular indexing to efficiently handle incoming data.
+         *          The buffer size is defined by `RX_SIZE`, and it uses circular indexing to efficiently handle incoming data.
          * @note The `volatile` keyword ensures that the compiler does not optimize the access to this buffer, as new data can be added at any time by the hardware.
          */
-        volatile uint8_t rxBuffer[UART_RX_BUFFER_SIZE]; /**< Receive buffer for UART data */
+        volatile uint8_t rxBuffer[RX_SIZE ? RX_SIZE : 1]; /**< Receive buffer for UART data */
 
         /**
          * @brief Buffer for storing data to be transmitted over UART.
          * @details This buffer holds the outgoing data to be sent over UART. The data is placed in this buffer before it is transmitted.
-         *          The buffer size is defined by `UART_TX_BUFFER_SIZE`, and it uses circular indexing to manage data transmission.
+         *          The buffer size is defined by `TX_SIZE`, and it uses circular indexing to manage data transmission.
          * @note The `volatile` keyword ensures that the compiler does not optimize the access to this buffer, as the data may change when written by the UART ISR.
          */
-        volatile uint8_t txBuffer[UART_TX_BUFFER_SIZE]; /**< Transmit buffer for UART data */
+        volatile uint8_t txBuffer[TX_SIZE ? TX_SIZE : 1]; /**< Transmit buffer for UART data */
 
         /**
          * @brief Indexes for managing the UART receive and transmit buffers.
@@ -328,16 +719,170 @@ class __UART__
          */
         uint8_t began; /**< Flag indicating whether the UART has been initialized */
 
+        /**
+         * @brief Error of the configured baud rate in hundredths of a percent, see `UARTBaud`.
+         */
+        int16_t baudErr; /**< Baud rate error */
+
+        /**
+         * @brief Transmit buffer overflow policy.
+         * @details Selects the behaviour of `write()` when the transmit buffer is full, see `setOverflowPolicy()`.
+         *          Defaults to `UART_OVERFLOW_BLOCK` (zero initialized).
+         */
+        uint8_t txPolicy; /**< Transmit buffer overflow policy */
+
+        /**
+         * @brief Flag indicating that bytes were queued since the last completed transmission.
+         * @details Set by `txStart()` together with clearing TXC, cleared by `isTransmitting()` once TXC is set again, or by
+         *          `isrTXC()` in RS-485 mode.
+         */
+        volatile uint8_t txActive; /**< Transmission in progress */
+
+        /**
+         * @brief Receive error counters.
+         * @details Updated by `isrRX()`, read with interrupts disabled by `stats()`.
+         */
+        volatile UARTStats rxStats; /**< Receive error counters */
+
+        #if UART_ENABLE_RX_CALLBACK
+        /**
+         * @brief Function invoked from `isrRX()` with every received byte, NULL if none.
+         */
+        volatile UARTRxCallback rxCallback; /**< Receive callback */
+        #endif
+
+        #if UART_ENABLE_IDLE_DETECT
+        /**
+         * @brief Mask wrapping the frame queue indexes.
+         */
+        static const uint8_t FRAME_MASK = (uint8_t)(UART_IDLE_FRAME_QUEUE_SIZE - 1);
+
+        /**
+         * @brief Idle-line detection state.
+         * @details `isrRX()` clears `rxIdle` and sets `rxFrameOpen` for every stored byte. `tick()` counts the silence and pushes
+         *          `rxHead` to `rxFrameEnds` when it reaches `rxIdleTicks`. `readFrame()` pops the frames.
+         */
+        volatile uint8_t rxIdle;                                  /**< Ticks elapsed since the last received byte */
+        volatile uint8_t rxFrameOpen;                             /**< A frame is being received */
+        uint8_t rxIdleTicks;                                      /**< Ticks of silence closing a frame */
+        volatile uint8_t rxFrameEnds[UART_IDLE_FRAME_QUEUE_SIZE]; /**< rxHead at the end of each complete frame */
+        volatile uint8_t rxFrameHead, rxFrameTail;                /**< Indices of the frame queue */
+        #endif
+
+        #if UART_ENABLE_LINE_MODE
+        /**
+         * @brief Line-oriented reception state.
+         * @details `rxLines` is incremented by `isrRX()` for every stored delimiter and decremented by `readLine()`.
+         */
+        volatile uint8_t rxLines; /**< Complete lines in the receive buffer */
+        uint8_t rxLineMode;       /**< Line counting enabled */
+        uint8_t rxDelimiter;      /**< Line delimiter */
+        #endif
+
+        #if UART_ENABLE_RS485
+        /**
+         * @brief RS-485 driver enable pin.
+         * @details `deMask` is 0 while the mode is disabled, `txSend()` and `isrTXC()` then leave `dePort` untouched.
+         */
+        volatile uint8_t* dePort; /**< PORTx register of the driver enable pin */
+        uint8_t deMask;           /**< Bit mask of the driver enable pin */
+        #endif
+
+        #if UART_ENABLE_MPCM
+        /**
+         * @brief Multi-processor communication mode state.
+         * @details While `rxAddressing` is set, `isrRX()` consumes the address frames and sets or clears MPCM depending on
+         *          whether they match `rxAddress`.
+         */
+        uint8_t rxAddress;             /**< Address of this node */
+        volatile uint8_t rxAddressing; /**< Address filtering enabled */
+        #endif
+
+        #if UART_ENABLE_FLOW_CONTROL || UART_ENABLE_XON_XOFF
+        /**
+         * @brief Receive buffer fill pausing the peer (RTS deasserted, XOFF sent), and fill at which it is resumed again.
+         */
+        static const uint8_t RX_HIGH = (uint8_t)(RX_SIZE - 1 - RX_SIZE / 4);
+        static const uint8_t RX_LOW = (uint8_t)(RX_SIZE / 4);
+        #endif
+
+        #if UART_ENABLE_FLOW_CONTROL
+        /**
+         * @brief RTS/CTS flow control state.
+         * @details A mask of 0 disables the corresponding pin. `rxPaused` is set by `isrRX()` when it deasserts RTS, `txPaused`
+         *          by `isrUDRE()` when it disables UDRIE because of CTS.
+         */
+        volatile uint8_t* rtsPort; /**< PORTx register of the RTS output */
+        volatile uint8_t* ctsPin;  /**< PINx register of the CTS input */
+        uint8_t rtsMask;           /**< Bit mask of the RTS output */
+        uint8_t ctsMask;           /**< Bit mask of the CTS input */
+        volatile uint8_t rxPaused; /**< RTS deasserted */
+        volatile uint8_t txPaused; /**< Transmission paused by CTS */
+        #endif
+
+        #if UART_ENABLE_URGENT_TX
+        /**
+         * @brief Mask wrapping the urgent queue indexes.
+         */
+        static const uint8_t URGENT_MASK = (uint8_t)(UART_URGENT_QUEUE_SIZE - 1);
+
+        /**
+         * @brief Urgent transmit lane.
+         * @details `urgentHead` and `urgentTail` run freely, their difference is the number of queued bytes, so every slot is
+         *          usable. `writeUrgent()` advances `urgentHead` and `isrUDRE()` advances `urgentTail`.
+         */
+        volatile uint8_t urgentBuffer[UART_URGENT_QUEUE_SIZE]; /**< Urgent bytes */
+        volatile uint8_t urgentHead, urgentTail;               /**< Indices of the urgent queue */
+        #endif
+
+        #if UART_ENABLE_MSPIM
+        /**
+         * @brief Master SPI mode transfer engine state.
+         * @details `spiTransfers` is a queue of two transfers starting at `spiRxSlot`, the oldest one. `spiQueued` transfers are
+         *          queued and `spiTxDone` of them are fully written, so `spiSend()` feeds the transfer at
+         *          `spiRxSlot + spiTxDone` and moves on to the next one while `spiReceive()` still completes the previous one.
+         *          `spiInFlight` bytes are written and not yet received, at most 2 so the 2-byte receive FIFO can't overrun.
+         */
+        volatile UARTTransfer spiTransfers[2]; /**< Queued transfers */
+        volatile uint16_t spiTxIndex;          /**< Next byte to write in the transfer fed by spiSend() */
+        volatile uint16_t spiRxIndex;          /**< Next byte to receive in the oldest transfer */
+        volatile uint8_t spiRxSlot;            /**< Slot of the oldest transfer */
+        volatile uint8_t spiQueued;            /**< Transfers queued or running */
+        volatile uint8_t spiTxDone;            /**< Queued transfers fully written */
+        volatile uint8_t spiInFlight;          /**< Bytes written and not yet received */
+        uint8_t spiMode;                       /**< The port runs in Master SPI mode */
+        #endif
+
+        #if UART_ENABLE_XON_XOFF
+        /**
+         * @brief XON/XOFF flow control state.
+         * @details `rxXoff` is set by `isrRX()` once its XOFF is queued and cleared by `rxRelease()` once XON is queued. `txXoff`
+         *          follows the XON/XOFF bytes received from the peer and makes `isrUDRE()` hold the transmit buffer.
+         */
+        uint8_t xonXoff;         /**< Software flow control enabled */
+        volatile uint8_t rxXoff; /**< XOFF sent to the peer */
+        volatile uint8_t txXoff; /**< XOFF received from the peer */
+        #endif
+
 };
 
-#if defined(__AVR_ATmega328__)  || \
-    defined(__AVR_ATmega328P__) || \
-    defined(__AVR_ATmega328PB__)
-    extern __UART__ UART0;
+/* Implementation */
+#include "UART.tpp"
+
+#if UART_HAS_PORT0 && UART_USE_PORT0
+    extern __UART__<__UART0_PORT__, UART0_RX_BUFFER_SIZE, UART0_TX_BUFFER_SIZE> UART0;
+#endif
+
+#if UART_HAS_PORT1 && UART_USE_PORT1
+    extern __UART__<__UART1_PORT__, UART1_RX_BUFFER_SIZE, UART1_TX_BUFFER_SIZE> UART1;
+#endif
+
+#if UART_HAS_PORT2 && UART_USE_PORT2
+    extern __UART__<__UART2_PORT__, UART2_RX_BUFFER_SIZE, UART2_TX_BUFFER_SIZE> UART2;
 #endif
 
-#if defined(__AVR_ATmega328PB__)
-    extern __UART__ UART1;
+#if UART_HAS_PORT3 && UART_USE_PORT3
+    extern __UART__<__UART3_PORT__, UART3_RX_BUFFER_SIZE, UART3_TX_BUFFER_SIZE> UART3;
 #endif
 
 
@@ -0,0 +1,1540 @@
+/* Implementation of the __UART__ template, included by UART.h */
+
+/**
+ * @brief Begins UART communication by setting the appropriate bits in the control registers
+ * @param baudrate The baud rate to set
+ * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+ * @return 1 if successful, 0 otherwise
+ * @details Both U2X modes are evaluated by `UARTBaud` and the one achieving the lowest error is programmed. The error is
+ *          available with `baudError()`. Only the directions the port is built with (non-zero buffer size) are enabled.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::begin(const uint32_t baudrate, const uint8_t config)
+{
+    return (this->open(baudrate, config, ENABLE));
+}
+
+/**
+ * @brief Begins UART communication with a baud rate solved at compile time
+ * @tparam BAUD The baud rate to set
+ * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+ * @return 1 if successful, 0 otherwise
+ * @details The U2X mode, UBRR value and error are constant expressions, no division is left at runtime. The build fails if
+ *          the error exceeds `UART_BAUD_ERROR_MAX`, e.g. `begin<250000>()`, `begin<500000>()` and `begin<1000000>()` are
+ *          exact at 16 MHz while `begin<230400>()` (-3.55 %) is rejected.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+template <uint32_t BAUD>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::begin(const uint8_t config)
+{
+    static_assert(BAUD > 0, "UART baud rate must not be zero");
+
+    constexpr uint8_t u2x = UARTBaud::u2x(F_CPU, BAUD);
+    constexpr uint16_t ubrr = UARTBaud::ubrr(F_CPU, BAUD, u2x ? 8 : 16);
+    constexpr int16_t error = UARTBaud::error(F_CPU, BAUD, u2x ? 8 : 16, ubrr);
+    static_assert(error <= UART_BAUD_ERROR_MAX && error >= -UART_BAUD_ERROR_MAX, "UART baud rate error exceeds UART_BAUD_ERROR_MAX at this F_CPU");
+    return (this->setup(ubrr, u2x, error, config, ENABLE));
+}
+
+/**
+ * @brief Begins a transmit-only UART communication, the RX pin is left to GPIO
+ * @param baudrate The baud rate to set
+ * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+ * @return 1 if successful, 0 otherwise
+ * @details The receiver and the RX interrupt stay disabled, so noise on a floating RX line raises no interrupt. A port built
+ *          with `RX_SIZE` 0 does the same with `begin()` and saves the receive buffer as well.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::beginTx(const uint32_t baudrate, const uint8_t config)
+{
+    static_assert(TX_SIZE, "UART port built without a transmit buffer");
+    return (this->open(baudrate, config, (1 << TXEN0)));
+}
+
+/**
+ * @brief Begins a receive-only UART communication, the TX pin is left to GPIO
+ * @param baudrate The baud rate to set
+ * @param config The frame format (`UART_8N1`, `UART_8E1`, `UART_7E1`, `UART_9N1`, ...)
+ * @return 1 if successful, 0 otherwise
+ * @details A port built with `TX_SIZE` 0 does the same with `begin()` and saves the transmit buffer as well.
+ * @note The transmitter is disabled, nothing must be written to the port until `end()`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::beginRx(const uint32_t baudrate, const uint8_t config)
+{
+    static_assert(RX_SIZE, "UART port built without a receive buffer");
+    return (this->open(baudrate, config, (1 << RXEN0) | (1 << RXCIE0)));
+}
+
+/**
+ * @brief Returns the error of the configured baud rate
+ * @return The error of the achieved rate in hundredths of a percent (e.g. 212 for +2.12 %), 0 before `begin()`
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const int16_t __UART__<PORT, RX_SIZE, TX_SIZE>::baudError(void)
+{
+    return (this->baudErr);
+}
+
+#if UART_ENABLE_MSPIM
+/**
+ * @brief Begins a Master SPI mode communication, XCK must already be configured as an output
+ * @param bitrate The highest acceptable SPI clock
+ * @param mode The SPI mode (`UART_SPI_MODE0` ... `UART_SPI_MODE3`), optionally or-ed with `UART_SPI_LSB_FIRST`
+ * @return 1 if successful, 0 otherwise
+ * @details Follows the datasheet initialization: UBRR is cleared, the mode and both directions are enabled, then the rate is
+ *          programmed. The clock is `F_CPU / (2 * (UBRR + 1))`, the fastest one not above `bitrate`, up to `F_CPU / 2`. The
+ *          asynchronous `read()`/`write()` family must not be used until `end()`, the data goes through `transfer()`.
+ * @code
+ * DDRB |= (1 << PB5);                   // XCK1 on the ATmega328PB
+ * UART1.beginSPI(4000000UL, UART_SPI_MODE0);
+ * UART1.transfer(frame, NULL, sizeof(frame));
+ * @endcode
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::beginSPI(const uint32_t bitrate, const uint8_t mode)
+{
+    if (!bitrate || this->began)
+        return (0);
+
+    this->began = 1;
+    this->baudErr = 0;
+    this->spiMode = 1;
+    this->spiRxSlot = 0;
+    this->spiQueued = 0;
+    this->spiTxDone = 0;
+    this->spiInFlight = 0;
+    this->spiTxIndex = 0;
+    this->spiRxIndex = 0;
+
+    sei(); /*!< Enable global interrupts */
+
+    const uint16_t ubrr = UARTBaud::spi(F_CPU, bitrate);
+    PORT::ubrrh() = 0;
+    PORT::ubrrl() = 0;
+    PORT::ucsra() = 0;
+    PORT::ucsrc() = (1 << UMSEL01) | \
+                    (1 << UMSEL00) | \
+                    (mode & (UART_SPI_MODE3 | UART_SPI_LSB_FIRST)); /*!< Master SPI mode */
+    PORT::ucsrb() = (1 << RXEN0) | \
+                    (1 << RXCIE0) | \
+                    (1 << TXEN0);                                    /*!< Enable RX, RX ISR, TX */
+    PORT::ubrrh() = (uint8_t)(ubrr >> 8);
+    PORT::ubrrl() = (uint8_t)ubrr;
+    return (1);
+}
+
+/**
+ * @brief Queues a full duplex transfer run in the background, waiting while two transfers are already queued
+ * @param tx Bytes to send, NULL to send 0xFF
+ * @param rx Destination of the received bytes, NULL to discard them
+ * @param size Number of bytes to exchange
+ * @details Returns as soon as the transfer is queued. Both buffers belong to the engine until `transferPending()` drops below
+ *          the number of transfers queued after this one, e.g. a double-buffered stream fills one buffer while the other one
+ *          is being sent and calls `transfer()` with it, which waits for the previous transfer only if it is still queued.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::transfer(const uint8_t* tx, uint8_t* rx, const uint16_t size)
+{
+    if (!size)
+        return;
+
+    while (this->spiQueued == 2);
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        volatile UARTTransfer& slot = this->spiTransfers[(this->spiRxSlot + this->spiQueued) & 1];
+        slot.tx = tx;
+        slot.rx = rx;
+        slot.size = size;
+        this->spiQueued++;
+        PORT::ucsrb() |= (1 << UDRIE0);
+    }
+}
+
+/**
+ * @brief Returns the number of transfers queued or running
+ * @return 0 once every queued transfer has completed, up to 2
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::transferPending(void)
+{
+    return (this->spiQueued);
+}
+
+/**
+ * @brief Master SPI mode part of `isrRX()`, stores a received byte into the oldest transfer
+ * @details Completing a transfer frees its slot and, since it may have throttled `spiSend()` on the in-flight limit, re-arms
+ *          UDRIE while bytes remain to be written.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::spiReceive(void)
+{
+    const uint8_t byte = PORT::udr();
+    if (!this->spiInFlight)
+        return; /*!< Nothing was sent, spurious byte */
+
+    volatile UARTTransfer& slot = this->spiTransfers[this->spiRxSlot];
+    const uint16_t index = this->spiRxIndex;
+    if (slot.rx)
+        slot.rx[index] = byte;
+    this->spiInFlight--;
+    if (index + 1 == slot.size)
+    {
+        this->spiRxIndex = 0;
+        this->spiRxSlot ^= 1;
+        this->spiTxDone--;
+        this->spiQueued--;
+    }
+    else
+        this->spiRxIndex = index + 1;
+
+    if (this->spiTxDone != this->spiQueued)
+        PORT::ucsrb() |= (1 << UDRIE0);
+}
+
+/**
+ * @brief Master SPI mode part of `isrUDRE()`, feeds the transmit pipeline from the queued transfers
+ * @details UDRIE is disabled once everything is written or while 2 bytes are in flight, `spiReceive()` re-arms it.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::spiSend(void)
+{
+    if (this->spiTxDone == this->spiQueued || this->spiInFlight >= 2)
+    {
+        PORT::ucsrb() &= ~(1 << UDRIE0);
+        return;
+    }
+
+    volatile UARTTransfer& slot = this->spiTransfers[(this->spiRxSlot + this->spiTxDone) & 1];
+    const uint16_t index = this->spiTxIndex;
+    PORT::udr() = slot.tx ? slot.tx[index] : 0xFF;
+    this->spiInFlight++;
+    if (index + 1 == slot.size)
+    {
+        this->spiTxIndex = 0;
+        this->spiTxDone++;
+    }
+    else
+        this->spiTxIndex = index + 1;
+}
+#endif
+
+/**
+ * @brief Solves the baud rate at runtime and enables the port
+ * @param baudrate The baud rate to set
+ * @param config The frame format
+ * @param enable The UCSRB enable bits (RXEN, RXCIE, TXEN)
+ * @return 1 if successful, 0 otherwise
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::open(const uint32_t baudrate, const uint8_t config, const uint8_t enable)
+{
+    if (!baudrate)
+        return (0);
+
+    const uint8_t u2x = UARTBaud::u2x(F_CPU, baudrate);
+    const uint8_t divider = u2x ? 8 : 16;
+    const uint16_t ubrr = UARTBaud::ubrr(F_CPU, baudrate, divider);
+    return (this->setup(ubrr, u2x, UARTBaud::error(F_CPU, baudrate, divider, ubrr), config, enable));
+}
+
+/**
+ * @brief Programs the baud rate and enables the port
+ * @param ubrr The UBRR value
+ * @param u2x 1 to enable the double speed mode
+ * @param error The error of the achieved rate, returned by `baudError()`
+ * @param config The frame format
+ * @param enable The UCSRB enable bits (RXEN, RXCIE, TXEN)
+ * @return 1 if successful, 0 if already started
+ * @details In the 9-bit formats the ninth data bit (TXB8) is transmitted as 0 and the ninth received bit (RXB8) is not stored.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::setup(const uint16_t ubrr, const uint8_t u2x, const int16_t error, const uint8_t config, const uint8_t enable)
+{
+    if (this->began)
+        return (0);
+
+    this->began = 1;
+    this->baudErr = error;
+
+    sei(); /*!< Enable global interrupts */
+
+    PORT::ucsra() = u2x ? (1 << U2X0) : 0;   /*!< Select the normal or double speed mode */
+    PORT::ubrrh() = (uint8_t)(ubrr >> 8);     /*!< Write <MSB> of the prescale */
+    PORT::ubrrl() = (uint8_t)ubrr;            /*!< Write <LSB> of the prescale */
+    PORT::ucsrc() = config & ~UART_CONFIG_9BIT; /*!< Set the data frame format */
+    if (config & UART_CONFIG_9BIT)
+        PORT::ucsrb() = (PORT::ucsrb() & ~(1 << TXB80)) | (1 << UCSZ02);
+    else
+        PORT::ucsrb() &= ~(1 << UCSZ02);
+    PORT::ucsrb() |= enable;                  /*!< Enable RX, RX ISR and/or TX */
+    return (1);
+}
+
+/**
+ * @brief Checks if data is available to read
+ * @return The number of bytes in the receive buffer, 0 if none
+ * @note Only `isrRX()` writes `rxHead` and only the main context writes `rxTail`. Both are single bytes, so reading them
+ *       needs no critical section.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::available(void)
+{
+    return ((uint8_t)(this->rxHead - this->rxTail) & RX_MASK);
+}
+
+/**
+ * @brief Clears the receive buffer
+ * @details Moves the consumer index `rxTail` onto `rxHead`, leaving `rxHead` to `isrRX()`. The line count and the idle-line
+ *          frame queue are cleared along with it, `end()` goes through here so a later `begin()` starts from a clean state.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::flush(void)
+{
+    #if UART_ENABLE_LINE_MODE || UART_ENABLE_IDLE_DETECT
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rxTail = this->rxHead;
+        #if UART_ENABLE_LINE_MODE
+        this->rxLines = 0;
+        #endif
+        #if UART_ENABLE_IDLE_DETECT
+        this->rxFrameHead = 0;
+        this->rxFrameTail = 0;
+        this->rxFrameOpen = 0;
+        #endif
+    }
+    #else
+    this->rxTail = this->rxHead;
+    #endif
+    this->rxRelease();
+}
+
+/**
+ * @brief Checks if UART is transmitting
+ * @return 1 if transmitting, 0 otherwise
+ * @details The transmission is over once the transmit buffer is empty (UDRIE disabled) and the transmit complete flag (TXC)
+ *          reports that the stop bit of the last byte has left the shift register.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::isTransmitting(void)
+{
+    if (this->txBusy())
+        return (1);
+    if (!this->txActive)
+        return (0);
+    if (!(PORT::ucsra() & (1 << TXC0)))
+        return (1);
+    this->txActive = 0;
+    return (0);
+}
+
+/**
+ * @brief Waits until every queued byte, stop bit included, has been transmitted
+ * @details While the transmit buffer drains, the wait goes through `txWait()`, which sleeps in `SLEEP_MODE_IDLE` between UDRE
+ *          interrupts when `UART_ENABLE_SLEEP_WAIT` is set. The last byte (at most one character time) is then awaited on the
+ *          TXC flag.
+ * @note A transmission paused by flow control is not complete: while the peer holds XOFF (or CTS deasserted), `flushTx()`
+ *       blocks until it resumes the transmission.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::flushTx(void)
+{
+    while (this->txBusy())
+        this->txWait();
+    while (this->isTransmitting());
+}
+
+/**
+ * @brief Reads a single byte from the receive buffer
+ * @return The byte read
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::read(void)
+{
+    static_assert(RX_SIZE, "UART port built without a receive buffer");
+    const uint8_t tail = this->rxTail;
+    if (this->rxHead == tail)
+        return (0);
+
+    const uint8_t byte = this->rxBuffer[tail];
+    this->rxTail = (uint8_t)(tail + 1) & RX_MASK;
+    this->rxRelease();
+    return (byte);
+}
+
+/**
+ * @brief Reads a byte array from the receive buffer
+ * @param n Pointer to the byte array
+ * @param size The size of the byte array
+ * @details Blocks until `size` bytes have been received, draining the receive buffer in blocks with `readAvailable()`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::read(uint8_t* n, const uint8_t size)
+{
+    for (uint8_t i = 0; i < size;)
+        i += this->readAvailable(n + i, size - i);
+}
+
+/**
+ * @brief Reads bytes from the receive buffer into a generic pointer
+ * @param n Pointer to the destination memory location
+ * @param size The number of bytes to read
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::read(void* n, const uint8_t size)
+{
+    this->read((uint8_t*)n, size);
+}
+
+/**
+ * @brief Reads every byte currently in the receive buffer, up to a maximum length, without blocking
+ * @param n Pointer to the byte array
+ * @param size The size of the byte array
+ * @return The number of bytes read
+ * @details The buffered data is copied in at most two contiguous spans with `rxCopy()`, then `rxTail` is published once.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::readAvailable(uint8_t* n, const uint8_t size)
+{
+    static_assert(RX_SIZE, "UART port built without a receive buffer");
+    const uint8_t tail = this->rxTail;
+    uint8_t count = (uint8_t)(this->rxHead - tail) & RX_MASK;
+    if (count > size)
+        count = size;
+    if (!count)
+        return (0);
+
+    this->rxCopy(n, tail, count);
+    this->rxTail = (uint8_t)(tail + count) & RX_MASK;
+    this->rxRelease();
+    return (count);
+}
+
+/**
+ * @brief Reads bytes from the receive buffer into a generic pointer, without blocking
+ * @param n Pointer to the destination memory location
+ * @param size The maximum number of bytes to read
+ * @return The number of bytes read
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::readAvailable(void* n, const uint8_t size)
+{
+    return (this->readAvailable((uint8_t*)n, size));
+}
+
+/**
+ * @brief Reads a byte array from the receive buffer, giving up when the line stays idle
+ * @param n Pointer to the byte array
+ * @param size The size of the byte array
+ * @param ticks The timeout in ticks of about 1 microsecond, restarted every time new data arrives
+ * @return The number of bytes read, less than `size` if the timeout expired
+ * @note The ticks are counted with `_delay_us(1)` between polls of the empty receive buffer, so the timeout is a busy wait
+ *       and runs slightly longer than `ticks` microseconds.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::readTimeout(uint8_t* n, const uint8_t size, const uint16_t ticks)
+{
+    uint8_t i = 0;
+    uint16_t idle = 0;
+    while (i < size)
+    {
+        const uint8_t count = this->readAvailable(n + i, size - i);
+        if (count)
+        {
+            i += count;
+            idle = 0;
+        }
+        else if (idle++ < ticks)
+            _delay_us(1);
+        else
+            break;
+    }
+    return (i);
+}
+
+/**
+ * @brief Borrows the longest contiguous run of received data directly inside the receive buffer
+ * @param p Set to the first unread byte inside `rxBuffer`
+ * @return The number of bytes readable at `*p`, 0 if the receive buffer is empty
+ * @details No data is copied. The run ends at `rxHead` or at the wrap around point, whichever comes first, so the remaining data
+ *          is returned by the next call after `consume()`. The span stays valid until it is consumed, since `isrRX()` only
+ *          writes past `rxHead`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::peekSpan(const uint8_t** p)
+{
+    static_assert(RX_SIZE, "UART port built without a receive buffer");
+    const uint8_t tail = this->rxTail;
+    const uint8_t count = (uint8_t)(this->rxHead - tail) & RX_MASK;
+    const uint16_t span = RX_SIZE - tail;
+    *p = (const uint8_t*)this->rxBuffer + tail;
+    return ((count <= span) ? count : (uint8_t)span);
+}
+
+/**
+ * @brief Releases bytes borrowed with `peekSpan()`
+ * @param size The number of bytes to release, clamped to the number of bytes in the receive buffer
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::consume(uint8_t size)
+{
+    const uint8_t tail = this->rxTail;
+    const uint8_t count = (uint8_t)(this->rxHead - tail) & RX_MASK;
+    if (size > count)
+        size = count;
+    this->rxTail = (uint8_t)(tail + size) & RX_MASK;
+    this->rxRelease();
+}
+
+#if UART_ENABLE_RX_CALLBACK
+/**
+ * @brief Registers the function invoked from `isrRX()` with every received byte
+ * @param callback The function, NULL to remove it
+ * @details The callback runs before the byte is buffered and decides whether it is stored, so latency critical bytes (e.g. an
+ *          emergency stop or a Modbus turnaround) are handled within a byte time and can bypass the receive buffer.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setRxCallback(const UARTRxCallback callback)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        this->rxCallback = callback;
+}
+#endif
+
+#if UART_ENABLE_IDLE_DETECT
+/**
+ * @brief Sets the silence closing a frame
+ * @param ticks The number of `tick()` calls without reception ending a frame (e.g. 4 for Modbus-RTU when ticking once per
+ *              character time), at least 1
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setIdleTimeout(const uint8_t ticks)
+{
+    this->rxIdleTicks = ticks ? ticks : 1;
+}
+
+/**
+ * @brief Advances the idle-line detection, call it periodically (e.g. from a timer interrupt)
+ * @details Once the line has been silent for the idle timeout, the frame being received is closed by pushing `rxHead` to the
+ *          frame queue. When the queue is full the frame stays open and merges with the next one.
+ * @note Call it with interrupts disabled or from an interrupt service routine, since `isrRX()` shares its state.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::tick(void)
+{
+    if (!this->rxFrameOpen || ++this->rxIdle < this->rxIdleTicks)
+        return;
+
+    const uint8_t head = this->rxFrameHead;
+    const uint8_t next = (uint8_t)(head + 1) & FRAME_MASK;
+    if (next == this->rxFrameTail)
+        return;
+    this->rxFrameEnds[head] = this->rxHead;
+    this->rxFrameHead = next;
+    this->rxFrameOpen = 0;
+}
+
+/**
+ * @brief Returns the length of the oldest complete frame
+ * @return The number of bytes of the frame, 0 if no complete frame is available
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::frameAvailable(void)
+{
+    const uint8_t frame = this->rxFrameTail;
+    if (frame == this->rxFrameHead)
+        return (0);
+    return ((uint8_t)(this->rxFrameEnds[frame] - this->rxTail) & RX_MASK);
+}
+
+/**
+ * @brief Reads the oldest complete frame from the receive buffer
+ * @param n Destination
+ * @param size The size of the destination, longer frames are truncated
+ * @return The number of bytes copied, 0 if no complete frame is available
+ * @details The frame is copied in bulk with `rxCopy()` and consumed whole, even when truncated.
+ * @note The frame boundaries assume the data is only consumed with `readFrame()`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::readFrame(uint8_t* n, const uint8_t size)
+{
+    const uint8_t frame = this->rxFrameTail;
+    if (frame == this->rxFrameHead)
+        return (0);
+
+    const uint8_t tail = this->rxTail;
+    const uint8_t end = this->rxFrameEnds[frame];
+    const uint8_t length = (uint8_t)(end - tail) & RX_MASK;
+    const uint8_t copied = (length < size) ? length : size;
+    this->rxCopy(n, tail, copied);
+    this->rxTail = end;
+    this->rxFrameTail = (uint8_t)(frame + 1) & FRAME_MASK;
+    this->rxRelease();
+    return (copied);
+}
+#endif
+
+#if UART_ENABLE_LINE_MODE
+/**
+ * @brief Enables line-oriented reception
+ * @param delimiter The character ending a line
+ * @details Lines already in the receive buffer are not counted, call it before the data arrives (e.g. right after `begin()`).
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setLineMode(const char delimiter)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rxDelimiter = (uint8_t)delimiter;
+        this->rxLineMode = 1;
+        this->rxLines = 0;
+    }
+}
+
+/**
+ * @brief Returns the number of complete lines in the receive buffer
+ * @return The number of delimiters received and not yet read with `readLine()`
+ * @note The count is maintained by `isrRX()` and `readLine()`, mixing `readLine()` with the other read functions on the same
+ *       data makes it inaccurate.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::lineAvailable(void)
+{
+    return (this->rxLines);
+}
+
+/**
+ * @brief Reads one complete line from the receive buffer
+ * @param s Destination, receives the line without its delimiter, null terminated
+ * @param size The size of the destination, longer lines are truncated
+ * @return The number of characters copied, 0 if no complete line is available
+ * @details The delimiter is located with `memchr()` over at most two spans of the receive buffer and the line copied in bulk
+ *          with `rxCopy()`. The whole line, delimiter included, is consumed even when truncated. When no delimiter is found
+ *          despite a non-zero line count, the count is reset to resynchronize it with the buffer.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::readLine(char* s, const uint8_t size)
+{
+    if (!this->rxLines || !size)
+        return (0);
+
+    const uint8_t tail = this->rxTail;
+    const uint8_t count = (uint8_t)(this->rxHead - tail) & RX_MASK;
+    const uint8_t* buffer = (const uint8_t*)this->rxBuffer;
+    const uint16_t span = RX_SIZE - tail;
+    uint8_t length;
+    const uint8_t* found = (const uint8_t*)memchr(buffer + tail, this->rxDelimiter, (count <= span) ? count : span);
+    if (found)
+        length = (uint8_t)(found - (buffer + tail));
+    else
+    {
+        if (count > span)
+            found = (const uint8_t*)memchr(buffer, this->rxDelimiter, count - span);
+        if (!found)
+        {
+            /* The counted delimiters were consumed by another read function or dropped on overflow */
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+                this->rxLines = 0;
+            return (0);
+        }
+        length = (uint8_t)(span + (found - buffer));
+    }
+
+    const uint8_t copied = (length < size) ? length : (uint8_t)(size - 1);
+    this->rxCopy((uint8_t*)s, tail, copied);
+    s[copied] = '\0';
+
+    this->rxTail = (uint8_t)(tail + length + 1) & RX_MASK;
+    this->rxRelease();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        this->rxLines--;
+    return (copied);
+}
+#endif
+
+#if UART_ENABLE_RS485
+/**
+ * @brief Enables the RS-485 half-duplex mode
+ * @param port The PORTx register of the driver enable pin (e.g. `&PORTD`), NULL to disable the mode
+ * @param bit The bit of the driver enable pin in `port` (e.g. `PD2`)
+ * @details Waits for the pending transmission, configures the pin as an output driven low (receiving) and enables the TXC
+ *          interrupt. The data direction register is found right below the PORTx register, as on every classic AVR.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setRS485(volatile uint8_t* port, const uint8_t bit)
+{
+    this->flushTx();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (this->deMask)
+            *this->dePort &= ~this->deMask;
+        if (port)
+        {
+            this->dePort = port;
+            this->deMask = (uint8_t)(1 << bit);
+            *port &= ~this->deMask;
+            *(port - 1) |= this->deMask;
+            PORT::ucsra() = (PORT::ucsra() & ((1 << U2X0) | (1 << MPCM0))) | (1 << TXC0);
+            PORT::ucsrb() |= (1 << TXCIE0);
+        }
+        else
+        {
+            this->deMask = 0;
+            PORT::ucsrb() &= ~(1 << TXCIE0);
+        }
+    }
+}
+#endif
+
+#if UART_ENABLE_MPCM
+/**
+ * @brief Enables the hardware address filtering, requires a 9-bit frame format
+ * @param address The address of this node
+ * @details Sets MPCM, so the receiver ignores the data frames until `isrRX()` sees an address frame matching `address`.
+ *          UCSRA is written with TXC as zero, which leaves the flag untouched.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setAddress(const uint8_t address)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rxAddress = address;
+        this->rxAddressing = 1;
+        PORT::ucsra() = (PORT::ucsra() & (1 << U2X0)) | (1 << MPCM0);
+    }
+}
+
+/**
+ * @brief Disables the hardware address filtering, every frame is received again
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::clearAddress(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rxAddressing = 0;
+        PORT::ucsra() = PORT::ucsra() & (1 << U2X0);
+    }
+}
+
+/**
+ * @brief Transmits an address frame (ninth bit set) selecting the node receiving the following data frames
+ * @param address The address of the node
+ * @details TXB8 is latched together with UDR into the shift register, so the transmit buffer is drained before TXB8 is set
+ *          and the address is awaited until it left UDR before TXB8 is cleared again. The following writes are data frames.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::writeAddress(const uint8_t address)
+{
+    while (this->txBusy())
+        this->txWait();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        PORT::ucsrb() |= (1 << TXB80);
+    this->txEnqueue(&address, 1);
+    while (this->txBusy())
+        this->txWait();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        PORT::ucsrb() &= ~(1 << TXB80);
+}
+#endif
+
+#if UART_ENABLE_FLOW_CONTROL
+/**
+ * @brief Enables the RTS/CTS hardware flow control, both pins are active low
+ * @param rtsPort The PORTx register of the RTS output (e.g. `&PORTD`), NULL for none
+ * @param rtsBit The bit of the RTS output in `rtsPort`
+ * @param ctsPort The PORTx register of the CTS input (e.g. `&PORTD`), NULL for none
+ * @param ctsBit The bit of the CTS input in `ctsPort`
+ * @details RTS is configured as an output driven low (ready to receive), CTS as an input without pull-up. As on every classic
+ *          AVR, the DDRx and PINx registers are found one and two addresses below PORTx.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setFlowControl(volatile uint8_t* rtsPort, const uint8_t rtsBit, volatile uint8_t* ctsPort, const uint8_t ctsBit)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rtsMask = 0;
+        this->rxPaused = 0;
+        if (rtsPort)
+        {
+            this->rtsPort = rtsPort;
+            this->rtsMask = (uint8_t)(1 << rtsBit);
+            *rtsPort &= ~this->rtsMask;
+            *(rtsPort - 1) |= this->rtsMask;
+        }
+
+        this->ctsMask = 0;
+        if (ctsPort)
+        {
+            this->ctsPin = ctsPort - 2;
+            this->ctsMask = (uint8_t)(1 << ctsBit);
+            *(ctsPort - 1) &= ~this->ctsMask;
+        }
+    }
+    this->txResume();
+}
+
+/**
+ * @brief Resumes a transmission paused by CTS, call it from the pin change interrupt of the CTS pin
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::isrCTS(void)
+{
+    this->txResume();
+}
+#endif
+
+#if UART_ENABLE_URGENT_TX
+/**
+ * @brief Queues a byte sent ahead of the transmit buffer, without blocking
+ * @param n The byte to send
+ * @return 1 if queued, 0 if the urgent queue is full
+ * @details The byte goes out right after the byte currently in UDR, ahead of everything waiting in `txBuffer` and regardless of
+ *          a CTS pause, so the latency of a protocol reply is bounded by two character times. Safe to call from an interrupt.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::writeUrgent(const uint8_t n)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        const uint8_t head = this->urgentHead;
+        if ((uint8_t)(head - this->urgentTail) >= UART_URGENT_QUEUE_SIZE)
+            return (0);
+        this->urgentBuffer[head & URGENT_MASK] = n;
+        this->urgentHead = head + 1;
+        this->txStart();
+    }
+    return (1);
+}
+#endif
+
+#if UART_ENABLE_XON_XOFF
+/**
+ * @brief Enables or disables the XON/XOFF software flow control
+ * @param enable 1 to enable, 0 to disable
+ * @details Forgets a pending XOFF of the peer and resumes the transmission. When disabling, a peer paused by our XOFF is released
+ *          with XON.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setXonXoff(const uint8_t enable)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->xonXoff = enable;
+        if (this->txXoff)
+        {
+            this->txXoff = 0;
+            if (this->txHead != this->txTail)
+                this->txStart();
+        }
+        if (!enable && this->rxXoff && this->writeUrgent(UART_XON))
+            this->rxXoff = 0;
+    }
+}
+#endif
+
+/**
+ * @brief Writes a single byte to the transmit buffer
+ * @param n The byte to write
+ * @details If the transmit buffer is full, the overflow policy set with `setOverflowPolicy()` decides what happens.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::write(const uint8_t n)
+{
+    static_assert(TX_SIZE, "UART port built without a transmit buffer");
+    const uint8_t head = (uint8_t)(this->txHead + 1) & TX_MASK;
+    while (head == this->txTail)
+        if (!this->txOverflow(1))
+            return;
+
+    this->txBuffer[this->txHead] = n;
+    this->txHead = head;
+    this->txStart();
+}
+
+/**
+ * @brief Writes a byte array to the transmit buffer
+ * @param n Pointer to the byte array
+ * @param size The size of the byte array
+ * @details Copies the data into the transmit buffer in blocks using `txEnqueue()`. Each block is published and the UDRIE
+ *          interrupt armed once, instead of once per byte. When the transmit buffer is full, the overflow policy set with
+ *          `setOverflowPolicy()` decides whether to wait, to drop the rest of the array or to drop the oldest queued bytes.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::write(const uint8_t* n, const uint8_t size)
+{
+    uint8_t remaining = size;
+    while (remaining)
+    {
+        const uint8_t queued = this->txEnqueue(n, remaining);
+        n += queued;
+        remaining -= queued;
+        if (remaining && !queued && !this->txOverflow(remaining))
+            return;
+    }
+}
+
+/**
+ * @brief Returns the number of bytes that can be written without blocking
+ * @return The free space in the transmit buffer
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::availableForWrite(void)
+{
+    return ((uint8_t)(this->txTail - this->txHead - 1) & TX_MASK);
+}
+
+/**
+ * @brief Writes as many bytes of a byte array as fit into the transmit buffer, without blocking
+ * @param n Pointer to the byte array
+ * @param size The size of the byte array
+ * @return The number of bytes queued, the rest of the array is left to the caller
+ * @details Unlike `write()`, this never waits for `isrUDRE()` and ignores the overflow policy, so it is safe to call from
+ *          latency critical code.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::tryWrite(const uint8_t* n, const uint8_t size)
+{
+    uint8_t queued = this->txEnqueue(n, size);
+    if (queued < size)
+        queued += this->txEnqueue(n + queued, size - queued); /*!< isrUDRE() may have freed space meanwhile */
+    return (queued);
+}
+
+/**
+ * @brief Writes as many bytes from a generic pointer as fit into the transmit buffer, without blocking
+ * @param n Pointer to the source memory location
+ * @param size The number of bytes to write
+ * @return The number of bytes queued
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::tryWrite(const void* n, const uint8_t size)
+{
+    return (this->tryWrite((const uint8_t*)n, size));
+}
+
+/**
+ * @brief Reserves a contiguous writable span directly inside the transmit buffer
+ * @param p Set to the first free byte inside `txBuffer`
+ * @param size The number of bytes wanted
+ * @return The number of bytes writable at `*p`, at most `size`, 0 if the transmit buffer is full
+ * @details No data is copied, the caller serializes straight into the ring and publishes the bytes with `commit()`.
+ *          The span ends at the wrap around point, so a frame crossing it is built in two spans: the second one is returned
+ *          by the next `reserve()` after `commit()`. Nothing is sent until `commit()`, since `isrUDRE()` stops at `txHead`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::reserve(uint8_t** p, const uint8_t size)
+{
+    static_assert(TX_SIZE, "UART port built without a transmit buffer");
+    const uint8_t head = this->txHead;
+    uint8_t count = (uint8_t)(this->txTail - head - 1) & TX_MASK;
+    const uint16_t span = TX_SIZE - head;
+    if (count > span)
+        count = (uint8_t)span;
+    if (count > size)
+        count = size;
+    *p = (uint8_t*)this->txBuffer + head;
+    return (count);
+}
+
+/**
+ * @brief Publishes bytes written into a span obtained with `reserve()` and starts their transmission
+ * @param size The number of bytes written, clamped to the free space of the transmit buffer
+ * @details Advances `txHead` once and arms the UDRIE interrupt once for the whole span.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::commit(uint8_t size)
+{
+    const uint8_t head = this->txHead;
+    const uint8_t count = (uint8_t)(this->txTail - head - 1) & TX_MASK;
+    if (size > count)
+        size = count;
+    if (!size)
+        return;
+    this->txHead = (uint8_t)(head + size) & TX_MASK;
+    this->txStart();
+}
+
+/**
+ * @brief Selects what the blocking `write()` and `print()` family do when the transmit buffer is full
+ * @param policy One of `UART_OVERFLOW_BLOCK`, `UART_OVERFLOW_DROP_NEWEST` or `UART_OVERFLOW_DROP_OLDEST`
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::setOverflowPolicy(const uint8_t policy)
+{
+    this->txPolicy = policy;
+}
+
+/**
+ * @brief Writes bytes from a generic pointer to the transmit buffer
+ * @param n Pointer to the source memory location
+ * @param size The number of bytes to write
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::write(const void* n, const uint8_t size)
+{
+    this->write((const uint8_t*)n, size);
+}
+
+/**
+ * @brief Disables the UART communication and releases associated resources.
+ * @details If the UART has been initialized (this->began is true), this function disables the UART.
+ *          It first waits for any ongoing transmission to complete, stop bit included, using `flushTx()`.
+ *          It then flushes the transmission buffer, effectively stopping any buffered data from being sent.
+ *          For AVR-based systems (e.g., ATmega328), this function clears control registers and disables the UART.
+ *          If the system is not supported (other than AVR-based), it throws an error.
+ * @return Returns 1 if UART was successfully disabled, 0 if UART was not started.
+ * @note This function is specific to AVR architectures. If used on other platforms, it may result in a compile-time error.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::end(void)
+{
+    if (!this->began)
+        return (0);
+
+    this->began = 0;
+    #if UART_ENABLE_MSPIM
+    while (this->spiQueued);
+    #endif
+    this->flushTx();
+    this->flush();
+    PORT::ubrrh() = 0;
+    PORT::ubrrl() = 0;
+    PORT::ucsra() = 0;
+    PORT::ucsrc() &= ~((1 << UPM01)  | \
+                       (1 << UPM00)  | \
+                       (1 << USBS0)  | \
+                       (1 << UCSZ01) | \
+                       (1 << UCSZ00));
+    PORT::ucsrb() &= ~((1 << RXEN0) | \
+                       (1 << RXCIE0) | \
+                       (1 << TXEN0) | \
+                       (1 << UDRIE0) | \
+                       (1 << UCSZ02));
+    #if UART_ENABLE_MSPIM
+    if (this->spiMode)
+    {
+        PORT::ucsrc() &= ~((1 << UMSEL01) | (1 << UMSEL00) | (1 << UCPOL0));
+        this->spiMode = 0;
+    }
+    #endif
+    #if UART_ENABLE_RS485
+    PORT::ucsrb() &= ~(1 << TXCIE0);
+    if (this->deMask)
+        *this->dePort &= ~this->deMask;
+    this->deMask = 0;
+    #endif
+    return (1);
+}
+
+/**
+ * @brief Copies as many bytes as fit into the transmit buffer.
+ * @param n Pointer to the byte array
+ * @param size The number of bytes to queue
+ * @return The number of bytes queued, 0 if the transmit buffer is full
+ * @details The free space is split in at most two contiguous spans (before and after the wrap around point) which are filled
+ *          with `memcpy()`. `txHead` is then published once and the UDRIE interrupt armed once for the whole block.
+ * @note Only the main context writes `txHead` and only `isrUDRE()` writes `txTail`, both are single bytes so no critical
+ *       section is needed to read them.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::txEnqueue(const uint8_t* n, const uint8_t size)
+{
+    static_assert(TX_SIZE, "UART port built without a transmit buffer");
+    const uint8_t head = this->txHead;
+    uint8_t count = (uint8_t)(this->txTail - head - 1) & TX_MASK; /*!< Free space in the transmit buffer */
+    if (count > size)
+        count = size;
+    if (!count)
+        return (0);
+
+    uint8_t* buffer = (uint8_t*)this->txBuffer; /*!< The span being filled is not visible to isrUDRE() yet */
+    const uint16_t span = TX_SIZE - head;       /*!< Contiguous space up to the wrap around point */
+    if (count <= span)
+        memcpy(buffer + head, n, count);
+    else
+    {
+        memcpy(buffer + head, n, span);
+        memcpy(buffer, n + span, count - span);
+    }
+
+    this->txHead = (uint8_t)(head + count) & TX_MASK;
+    this->txStart();
+    return (count);
+}
+
+/**
+ * @brief Copies a string from program memory into the transmit buffer, up to the free contiguous space.
+ * @param s Pointer to the string in program memory, advanced past the queued characters
+ * @param stop Character ending the copy besides the null terminator (0 for none), left unconsumed at `*s`
+ * @return 1 once the null terminator or `stop` has been reached, 0 if the string continues
+ * @details Every character is read from flash exactly once, sequential `pgm_read_byte()` calls compile to `lpm Z+`.
+ *          The chunk stops at the wrap around point or at `txTail`, then `txHead` is published and the UDRIE interrupt
+ *          armed once for the whole chunk.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::txEnqueueFlash(const char** s, const char stop)
+{
+    static_assert(TX_SIZE, "UART port built without a transmit buffer");
+    const uint8_t head = this->txHead;
+    uint8_t count = (uint8_t)(this->txTail - head - 1) & TX_MASK;
+    const uint16_t span = TX_SIZE - head;
+    if (count > span)
+        count = (uint8_t)span;
+
+    uint8_t* buffer = (uint8_t*)this->txBuffer + head;
+    const char* ptr = *s;
+    uint8_t done = 0;
+    uint8_t i = 0;
+    while (i < count)
+    {
+        const uint8_t c = pgm_read_byte(ptr);
+        if (!c || c == (uint8_t)stop)
+        {
+            done = 1;
+            break;
+        }
+        buffer[i++] = c;
+        ptr++;
+    }
+    if (!count)
+    {
+        const uint8_t c = pgm_read_byte(ptr);
+        done = (!c || c == (uint8_t)stop); /*!< Buffer full, still report an empty remainder */
+    }
+
+    *s = ptr;
+    if (i)
+    {
+        this->txHead = (uint8_t)(head + i) & TX_MASK;
+        this->txStart();
+    }
+    return (done);
+}
+
+/**
+ * @brief Copies bytes out of the receive buffer without consuming them
+ * @param n Destination
+ * @param tail Index of the first byte to copy
+ * @param size The number of bytes to copy, at most the number of bytes in the receive buffer
+ * @details The data is copied in at most two contiguous spans (before and after the wrap around point) with `memcpy()`.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::rxCopy(uint8_t* n, const uint8_t tail, const uint8_t size)
+{
+    static_assert(RX_SIZE, "UART port built without a receive buffer");
+    const uint8_t* buffer = (const uint8_t*)this->rxBuffer; /*!< isrRX() does not touch the published span */
+    const uint16_t span = RX_SIZE - tail;                   /*!< Contiguous data up to the wrap around point */
+    if (size <= span)
+        memcpy(n, buffer + tail, size);
+    else
+    {
+        memcpy(n, buffer + tail, span);
+        memcpy(n + span, buffer, size - span);
+    }
+}
+
+/**
+ * @brief Applies the overflow policy when the transmit buffer is full.
+ * @param size The number of bytes waiting to be queued
+ * @return 1 if the caller should retry queueing, 0 if the pending bytes must be discarded
+ * @details - `UART_OVERFLOW_BLOCK`: the caller keeps retrying until `isrUDRE()` frees space.
+ *          - `UART_OVERFLOW_DROP_NEWEST`: the pending bytes are discarded.
+ *          - `UART_OVERFLOW_DROP_OLDEST`: up to `size` of the oldest queued bytes are discarded to make room.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::txOverflow(const uint8_t size)
+{
+    if (this->txPolicy == UART_OVERFLOW_DROP_NEWEST)
+        return (0);
+
+    if (this->txPolicy == UART_OVERFLOW_DROP_OLDEST)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            uint8_t used = (uint8_t)(this->txHead - this->txTail) & TX_MASK;
+            if (used > size)
+                used = size;
+            this->txTail = (uint8_t)(this->txTail + used) & TX_MASK; /*!< txTail belongs to isrUDRE(), move it with interrupts off */
+        }
+    }
+    else
+        this->txWait();
+    return (1);
+}
+
+/**
+ * @brief Arms the transmission of newly queued bytes
+ * @details Clears the TXC flag (by writing it to one, preserving U2X and MPCM), so `isTransmitting()` and `flushTx()` wait for the
+ *          new bytes to leave the shift register, then enables the UDRE interrupt. Runs with interrupts disabled, so the state
+ *          and the registers are updated together.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::txStart(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->txActive = 1;
+        #if UART_ENABLE_FLOW_CONTROL
+        this->txPaused = 0;
+        #endif
+        PORT::ucsra() = (PORT::ucsra() & ((1 << U2X0) | (1 << MPCM0))) | (1 << TXC0);
+        PORT::ucsrb() |= (1 << UDRIE0);
+    }
+}
+
+/**
+ * @brief Writes a byte to UDR, asserting the RS-485 driver enable pin first
+ * @param byte The byte to transmit
+ * @details The driver is only enabled once a byte really goes out, so the TXC interrupt that follows it always releases the
+ *          bus. A transmission armed while CTS or XOFF pauses it therefore never leaves the driver enabled on a silent line.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::txSend(const uint8_t byte)
+{
+    #if UART_ENABLE_RS485
+    if (this->deMask)
+        *this->dePort |= this->deMask;
+    #endif
+    PORT::udr() = byte;
+}
+
+/**
+ * @brief Tells whether queued bytes are waiting for `isrUDRE()`
+ * @return 1 while UDRIE is set or the transmission is paused by CTS or XOFF, 0 otherwise
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline const uint8_t __UART__<PORT, RX_SIZE, TX_SIZE>::txBusy(void)
+{
+    #if UART_ENABLE_FLOW_CONTROL
+    if (this->txPaused)
+        return (1);
+    #endif
+    #if UART_ENABLE_XON_XOFF
+    if (this->txXoff && this->txHead != this->txTail)
+        return (1);
+    #endif
+    return (PORT::ucsrb() & (1 << UDRIE0)) ? 1 : 0;
+}
+
+/**
+ * @brief Re-arms a transmission paused by CTS once CTS is asserted again
+ * @details If CTS is deasserted again before the next byte, `isrUDRE()` pauses the transmission once more.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::txResume(void)
+{
+    #if UART_ENABLE_FLOW_CONTROL
+    if (this->txPaused && !(this->ctsMask && (*this->ctsPin & this->ctsMask)))
+        this->txStart();
+    #endif
+}
+
+/**
+ * @brief Resumes the peer (RTS asserted, XON sent) once the reads brought the receive buffer below the low watermark
+ * @details Called after every update of `rxTail`. The fill is checked again with interrupts disabled, so a byte received
+ *          meanwhile can't deassert RTS just before it is asserted here. If the urgent queue is full, XON is sent by a later read.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::rxRelease(void)
+{
+    #if UART_ENABLE_XON_XOFF
+    if (this->rxXoff)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            if (((uint8_t)(this->rxHead - this->rxTail) & RX_MASK) <= RX_LOW && this->writeUrgent(UART_XON))
+                this->rxXoff = 0;
+        }
+    }
+    #endif
+    #if UART_ENABLE_FLOW_CONTROL
+    if (!this->rxPaused)
+        return;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if (((uint8_t)(this->rxHead - this->rxTail) & RX_MASK) <= RX_LOW)
+        {
+            *this->rtsPort &= ~this->rtsMask;
+            this->rxPaused = 0;
+        }
+    }
+    #endif
+}
+
+/**
+ * @brief Waits for `isrUDRE()` to make progress on the transmit buffer
+ * @details - With global interrupts disabled (e.g. when printing from an ISR), `isrUDRE()` cannot run, so the UDRE flag is polled
+ *            and the routine called directly instead of deadlocking.
+ *          - With `UART_ENABLE_SLEEP_WAIT`, the CPU enters `SLEEP_MODE_IDLE` until the next interrupt. The UDRIE check and the
+ *            sleep are atomic: the instruction following `sei` always executes before a pending interrupt, so the wake up event
+ *            cannot be missed.
+ *          - Otherwise it returns immediately and the caller spins.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::txWait(void)
+{
+    this->txResume();
+    if (!(SREG & (1 << SREG_I)))
+    {
+        if (PORT::ucsra() & (1 << UDRE0))
+            this->isrUDRE();
+        return;
+    }
+
+    #if UART_ENABLE_SLEEP_WAIT
+    cli();
+    if (PORT::ucsrb() & (1 << UDRIE0))
+    {
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+    sei();
+    #endif
+}
+
+/**
+ * @brief Streams a string from program memory into the transmit buffer, applying the overflow policy
+ * @param s Pointer to the string in program memory, advanced to the null terminator or to `stop`
+ * @param stop Character ending the string besides the null terminator (0 for none)
+ * @details In `UART_OVERFLOW_BLOCK` mode a full buffer is simply waited on with `txWait()`. The drop policies count the rest of
+ *          the string once per full buffer, and when they discard it `*s` is still advanced to the end of it.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::printFlash(const char** s, const char stop)
+{
+    while (!this->txEnqueueFlash(s, stop))
+    {
+        if (this->availableForWrite())
+            continue; /*!< Stopped at the wrap around point, continue at the start of the buffer */
+        if (this->txPolicy == UART_OVERFLOW_BLOCK)
+        {
+            this->txWait();
+            continue;
+        }
+
+        /* Only the drop policies need the length of the rest of the string */
+        uint16_t remaining = 0;
+        for (uint8_t c = pgm_read_byte(*s); c && c != (uint8_t)stop; c = pgm_read_byte(*s + remaining))
+            remaining++;
+        if (!this->txOverflow((remaining > UINT8_MAX) ? UINT8_MAX : (uint8_t)remaining))
+        {
+            *s += remaining;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Returns a snapshot of the receive error counters
+ * @return A copy of the counters, taken with interrupts disabled so every field is consistent
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+const UARTStats __UART__<PORT, RX_SIZE, TX_SIZE>::stats(void)
+{
+    UARTStats copy;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        copy.overrun = this->rxStats.overrun;
+        copy.framing = this->rxStats.framing;
+        copy.parity = this->rxStats.parity;
+        copy.overflow = this->rxStats.overflow;
+        copy.highWater = this->rxStats.highWater;
+    }
+    return (copy);
+}
+
+/**
+ * @brief Clears the receive error counters and the high-water mark
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+void __UART__<PORT, RX_SIZE, TX_SIZE>::resetStats(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        this->rxStats.overrun = 0;
+        this->rxStats.framing = 0;
+        this->rxStats.parity = 0;
+        this->rxStats.overflow = 0;
+        this->rxStats.highWater = 0;
+    }
+}
+
+/**
+ * @brief ISR (Interrupt Service Routine) for receiving data on the UART.
+ * @details This function is triggered by the UART receive interrupt. It reads the incoming byte from the UART data register (UDR) 
+ *          and stores it in the receive buffer (`rxBuffer`). The buffer index (`rxHead`) is then incremented in a circular manner 
+ *          using the `RX_MASK` index mask to prevent overflow and ensure continuous reception.
+ *          The status flags are read from UCSRA before UDR (reading UDR clears them) and the hardware overrun, framing and parity
+ *          errors are counted in `rxStats`. When the receive buffer is full the byte is discarded and counted as a software
+ *          overflow, instead of wrapping `rxHead` onto `rxTail`. With `UART_ENABLE_RX_CALLBACK`, the registered callback
+ *          sees the byte first and may skip the buffer. With `UART_ENABLE_MPCM`, address frames are not stored: they clear
+ *          MPCM when they match the node address and set it otherwise.
+ * @note This function is interrupt-driven, meaning it runs automatically when new data is received over UART.
+ *       It should be as fast as possible to avoid interrupt delays. The registers are resolved at compile time through `PORT`
+ *       and the function is inlined into the vector, so the hardware is accessed with direct `lds`/`sts` instructions.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::isrRX(void)
+{
+    #if UART_ENABLE_MSPIM
+    if (this->spiMode)
+    {
+        this->spiReceive();
+        return;
+    }
+    #endif
+    const uint8_t status = PORT::ucsra();
+    #if UART_ENABLE_MPCM
+    const uint8_t ninth = PORT::ucsrb() & (1 << RXB80);
+    #endif
+    const uint8_t byte = PORT::udr();
+    if (status & ((1 << FE0) | (1 << DOR0) | (1 << UPE0)))
+    {
+        if (status & (1 << DOR0)) this->rxStats.overrun++;
+        if (status & (1 << FE0))  this->rxStats.framing++;
+        if (status & (1 << UPE0)) this->rxStats.parity++;
+    }
+
+    #if UART_ENABLE_MPCM
+    if (ninth && this->rxAddressing)
+    {
+        PORT::ucsra() = (status & (1 << U2X0)) | ((byte == this->rxAddress) ? 0 : (1 << MPCM0));
+        return;
+    }
+    #endif
+
+    #if UART_ENABLE_XON_XOFF
+    if (this->xonXoff && (byte == UART_XON || byte == UART_XOFF))
+    {
+        this->txXoff = (byte == UART_XOFF);
+        if (!this->txXoff && this->txHead != this->txTail)
+            this->txStart();
+        return;
+    }
+    #endif
+
+    #if UART_ENABLE_RX_CALLBACK
+    const UARTRxCallback callback = this->rxCallback;
+    if (callback && !callback(byte))
+        return;
+    #endif
+
+    const uint8_t head = this->rxHead;
+    const uint8_t next = (uint8_t)(head + 1) & RX_MASK;
+    const uint8_t tail = this->rxTail;
+    if (next == tail)
+    {
+        this->rxStats.overflow++;
+        return;
+    }
+
+    this->rxBuffer[head] = byte;
+    this->rxHead = next;
+
+    #if UART_ENABLE_LINE_MODE
+    if (this->rxLineMode && byte == this->rxDelimiter)
+        this->rxLines++;
+    #endif
+
+    #if UART_ENABLE_IDLE_DETECT
+    this->rxIdle = 0;
+    this->rxFrameOpen = 1;
+    #endif
+
+    const uint8_t used = (uint8_t)(next - tail) & RX_MASK;
+    if (used > this->rxStats.highWater)
+        this->rxStats.highWater = used;
+
+    #if UART_ENABLE_FLOW_CONTROL
+    if (used >= RX_HIGH && this->rtsMask)
+    {
+        *this->rtsPort |= this->rtsMask;
+        this->rxPaused = 1;
+    }
+    #endif
+
+    #if UART_ENABLE_XON_XOFF
+    if (used >= RX_HIGH && this->xonXoff && !this->rxXoff && this->writeUrgent(UART_XOFF))
+        this->rxXoff = 1;
+    #endif
+}
+
+/**
+ * @brief ISR (Interrupt Service Routine) for transmitting data on the UART.
+ * @details This function is triggered when the UART's transmit buffer is empty and ready to send more data.
+ *          If there is data remaining in the transmit buffer (`txBuffer`), it retrieves the next byte to be sent from the `txBuffer`
+ *          and writes it to the UART data register (UDR). The `txTail` pointer is then incremented in a circular manner.
+ *          If the transmit buffer is empty (i.e., all data has been sent), the UDRIE0 interrupt is disabled to prevent further interrupts 
+ *          until new data is available. Bytes queued with `writeUrgent()` are always sent first.
+ * @note This function ensures that UART data transmission occurs continuously without interruption, as long as there is data in the buffer.
+ *       It should be kept fast to avoid delaying the transmission process. Like `isrRX()`, it is inlined into the vector.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::isrUDRE(void)
+{
+    #if UART_ENABLE_MSPIM
+    if (this->spiMode)
+    {
+        this->spiSend();
+        return;
+    }
+    #endif
+    #if UART_ENABLE_URGENT_TX
+    const uint8_t urgent = this->urgentTail;
+    if (this->urgentHead != urgent)
+    {
+        this->txSend(this->urgentBuffer[urgent & URGENT_MASK]);
+        this->urgentTail = urgent + 1;
+        return;
+    }
+    #endif
+    if (this->txHead != this->txTail)
+    {
+        #if UART_ENABLE_FLOW_CONTROL
+        if (this->ctsMask && (*this->ctsPin & this->ctsMask))
+        {
+            PORT::ucsrb() &= ~(1 << UDRIE0);
+            this->txPaused = 1;
+            return;
+        }
+        #endif
+        #if UART_ENABLE_XON_XOFF
+        if (this->txXoff)
+        {
+            PORT::ucsrb() &= ~(1 << UDRIE0);
+            return;
+        }
+        #endif
+        this->txSend(this->txBuffer[this->txTail]);
+        this->txTail = (uint8_t)(this->txTail + 1) & TX_MASK;
+    }
+    else
+    {
+        PORT::ucsrb() &= ~(1 << UDRIE0);
+    }
+}
+
+#if UART_ENABLE_RS485
+/**
+ * @brief ISR (Interrupt Service Routine) for the end of a transmission on the UART.
+ * @details Triggered when the stop bit of the last byte has left the shift register while UDR was empty. Unless `isrUDRE()` has
+ *          more bytes to send (UDRIE still set, the interrupt then only reports a gap between bytes), the driver enable pin is
+ *          released and the transmission is marked complete, since entering the vector already cleared TXC. This includes a
+ *          transmission paused by CTS or XOFF with bytes left in the buffer: the bus is handed back to the peer and `txStart()`
+ *          arms the transmission again on resume, `txSend()` then re-asserts the driver.
+ */
+template <class PORT, uint16_t RX_SIZE, uint16_t TX_SIZE>
+inline void __UART__<PORT, RX_SIZE, TX_SIZE>::isrTXC(void)
+{
+    if (PORT::ucsrb() & (1 << UDRIE0))
+        return;
+    if (this->deMask)
+        *this->dePort &= ~this->deMask;
+    this->txActive = 0;
+}
+#endif
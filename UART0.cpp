@@ -1,13 +1,8 @@
 /* Dependencies */
 #include "UART.h"
 
-#if defined(__AVR_ATmega328__) || \
-    defined(__AVR_ATmega328P__) || \
-    defined(__AVR_ATmega328PB__)
-__UART__ UART0 = __UART__(&UBRR0H, &UBRR0L, &UCSR0A, &UCSR0B, &UCSR0C, &UDR0);
-#else
-#error "Can't create instance of UART bus 0"
-#endif
+#if UART_HAS_PORT0 && UART_USE_PORT0
+__UART__<__UART0_PORT__, UART0_RX_BUFFER_SIZE, UART0_TX_BUFFER_SIZE> UART0;
 
 /************************
 Function: Interrupt Service Routine
@@ -15,14 +10,12 @@ Purpose:  Handling interrupts of UART RX
 Input:    Interrupt vector
 Return:   None
 ************************/
-#if defined(__AVR_ATmega328__) || \
-    defined(__AVR_ATmega328P__)
-ISR(USART_RX_vect) { UART0.isrRX(); }
-#elif defined(__AVR_ATmega328PB__)
-ISR(USART0_RX_vect)  { UART0.isrRX(); }
-#else
-#error "Can't create an UART bus 0 RX interrupt routine"
-#endif
+ISR(UART0_RX_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_RX_BIT);
+    UART0.isrRX();
+    UART_TRACE_EXIT(UART_TRACE_RX_BIT);
+}
 
 /************************
 Function: Interrupt Service Routine
@@ -30,11 +23,20 @@ Purpose:  Handling interrupts of UART UDRE
 Input:    Interrupt vector
 Return:   None
 ************************/
-#if defined(__AVR_ATmega328__) || \
-    defined(__AVR_ATmega328P__)
-ISR(USART_UDRE_vect) { UART0.isrUDRE(); }
-#elif defined(__AVR_ATmega328PB__)
-ISR(USART0_UDRE_vect)  { UART0.isrUDRE(); }
-#else
-#error "Can't create an UART bus 0 UDRE interrupt routine"
-#endif
\ No newline at end of file
+ISR(UART0_UDRE_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_UDRE_BIT);
+    UART0.isrUDRE();
+    UART_TRACE_EXIT(UART_TRACE_UDRE_BIT);
+}
+
+#if UART_ENABLE_RS485
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART TXC (RS-485 driver release)
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART0_TX_VECTOR) { UART0.isrTXC(); }
+#endif
+#endif
@@ -1,11 +1,8 @@
 /* Dependencies */
 #include "UART.h"
 
-#if defined(__AVR_ATmega328PB__)
-__UART__ UART1 = __UART__(&UBRR1H, &UBRR1L, &UCSR1A, &UCSR1B, &UCSR1C, &UDR1);
-#else
-#error "Can't create instance of UART 1 bus"
-#endif
+#if UART_HAS_PORT1 && UART_USE_PORT1
+__UART__<__UART1_PORT__, UART1_RX_BUFFER_SIZE, UART1_TX_BUFFER_SIZE> UART1;
 
 /************************
 Function: Interrupt Service Routine
@@ -13,11 +10,12 @@ Purpose:  Handling interrupts of UART RX
 Input:    Interrupt vector
 Return:   None
 ************************/
-#if defined(__AVR_ATmega328PB__)
-ISR(USART1_RX_vect)  { UART1.isrRX(); }
-#else
-#error "Can't create an UART bus 1 RX interrupt routine"
-#endif
+ISR(UART1_RX_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_RX_BIT);
+    UART1.isrRX();
+    UART_TRACE_EXIT(UART_TRACE_RX_BIT);
+}
 
 /************************
 Function: Interrupt Service Routine
@@ -25,8 +23,20 @@ Purpose:  Handling interrupts of UART UDRE
 Input:    Interrupt vector
 Return:   None
 ************************/
-#if defined(__AVR_ATmega328PB__)
-ISR(USART1_UDRE_vect)  { UART1.isrUDRE(); }
-#else
-#error "Can't create an UART bus 1 UDRE interrupt routine"
-#endif
\ No newline at end of file
+ISR(UART1_UDRE_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_UDRE_BIT);
+    UART1.isrUDRE();
+    UART_TRACE_EXIT(UART_TRACE_UDRE_BIT);
+}
+
+#if UART_ENABLE_RS485
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART TXC (RS-485 driver release)
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART1_TX_VECTOR) { UART1.isrTXC(); }
+#endif
+#endif
@@ -0,0 +1,42 @@
+/* Dependencies */
+#include "UART.h"
+
+#if UART_HAS_PORT2 && UART_USE_PORT2
+__UART__<__UART2_PORT__, UART2_RX_BUFFER_SIZE, UART2_TX_BUFFER_SIZE> UART2;
+
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART RX
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART2_RX_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_RX_BIT);
+    UART2.isrRX();
+    UART_TRACE_EXIT(UART_TRACE_RX_BIT);
+}
+
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART UDRE
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART2_UDRE_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_UDRE_BIT);
+    UART2.isrUDRE();
+    UART_TRACE_EXIT(UART_TRACE_UDRE_BIT);
+}
+
+#if UART_ENABLE_RS485
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART TXC (RS-485 driver release)
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART2_TX_VECTOR) { UART2.isrTXC(); }
+#endif
+#endif
@@ -0,0 +1,42 @@
+/* Dependencies */
+#include "UART.h"
+
+#if UART_HAS_PORT3 && UART_USE_PORT3
+__UART__<__UART3_PORT__, UART3_RX_BUFFER_SIZE, UART3_TX_BUFFER_SIZE> UART3;
+
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART RX
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART3_RX_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_RX_BIT);
+    UART3.isrRX();
+    UART_TRACE_EXIT(UART_TRACE_RX_BIT);
+}
+
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART UDRE
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART3_UDRE_VECTOR)
+{
+    UART_TRACE_ENTER(UART_TRACE_UDRE_BIT);
+    UART3.isrUDRE();
+    UART_TRACE_EXIT(UART_TRACE_UDRE_BIT);
+}
+
+#if UART_ENABLE_RS485
+/************************
+Function: Interrupt Service Routine
+Purpose:  Handling interrupts of UART TXC (RS-485 driver release)
+Input:    Interrupt vector
+Return:   None
+************************/
+ISR(UART3_TX_VECTOR) { UART3.isrTXC(); }
+#endif
+#endif
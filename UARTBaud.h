@@ -0,0 +1,108 @@
+#ifndef __UART_BAUD_H__
+#define __UART_BAUD_H__
+
+/* Dependencies */
+#include <stdint.h>
+
+/**
+ * @brief Largest value of the 12-bit UBRR register.
+ */
+#define UART_BAUD_UBRR_MAX (const uint16_t)0x0FFF
+
+/**
+ * @brief Baud rate solver.
+ * @details The USART divides the clock by 16 (U2X = 0) or 8 (U2X = 1) and by UBRR + 1. For both modes the solver rounds UBRR to
+ *          the nearest divisor, computes the error of the achieved rate and picks the mode with the lowest error, preferring
+ *          U2X = 0 (more receiver samples per bit) on ties. The functions are `constexpr`, so `__UART__::begin<BAUD>()` resolves
+ *          everything at compile time, while `__UART__::begin(baudrate)` runs the very same computation.
+ * @note The errors are expressed in hundredths of a percent of the requested rate (e.g. 212 for +2.12 %), positive when the
+ *       achieved rate is faster. The arithmetic holds for clocks up to 21 MHz.
+ */
+class UARTBaud
+{
+    public:
+        /**
+         * @brief Returns the UBRR value closest to the requested rate
+         * @param clock The CPU clock in Hz
+         * @param baudrate The requested baud rate
+         * @param divider 16 for U2X = 0, 8 for U2X = 1
+         * @return The rounded UBRR value, clamped to the register range
+         */
+        static constexpr uint16_t ubrr(const uint32_t clock, const uint32_t baudrate, const uint8_t divider)
+        {
+            return (clamp((clock + (uint32_t)divider * baudrate / 2) / ((uint32_t)divider * baudrate)));
+        }
+
+        /**
+         * @brief Returns the error of a UBRR value
+         * @param clock The CPU clock in Hz
+         * @param baudrate The requested baud rate
+         * @param divider 16 for U2X = 0, 8 for U2X = 1
+         * @param ubrr The UBRR value
+         * @return The error of the achieved rate in hundredths of a percent, saturated to the `int16_t` range
+         */
+        static constexpr int16_t error(const uint32_t clock, const uint32_t baudrate, const uint8_t divider, const uint16_t ubrr)
+        {
+            return (relative(clock, (uint32_t)divider * (ubrr + 1UL) * baudrate));
+        }
+
+        /**
+         * @brief Returns the error of the best UBRR value of a mode
+         * @param clock The CPU clock in Hz
+         * @param baudrate The requested baud rate
+         * @param divider 16 for U2X = 0, 8 for U2X = 1
+         * @return The error of the achieved rate in hundredths of a percent
+         */
+        static constexpr int16_t error(const uint32_t clock, const uint32_t baudrate, const uint8_t divider)
+        {
+            return (error(clock, baudrate, divider, ubrr(clock, baudrate, divider)));
+        }
+
+        /**
+         * @brief Tells whether the double speed mode gives the lowest error
+         * @param clock The CPU clock in Hz
+         * @param baudrate The requested baud rate
+         * @return 1 to set U2X, 0 otherwise
+         */
+        static constexpr uint8_t u2x(const uint32_t clock, const uint32_t baudrate)
+        {
+            return (magnitude(error(clock, baudrate, 8)) < magnitude(error(clock, baudrate, 16)));
+        }
+
+        /**
+         * @brief Returns the UBRR value of the fastest Master SPI mode rate not above the requested one
+         * @param clock The CPU clock in Hz
+         * @param bitrate The requested bit rate, the USART clocks at `clock / (2 * (UBRR + 1))`
+         * @return The UBRR value, clamped to the register range
+         */
+        static constexpr uint16_t spi(const uint32_t clock, const uint32_t bitrate)
+        {
+            return (clamp((clock + 2 * bitrate - 1) / (2 * bitrate)));
+        }
+
+    private:
+        static constexpr uint16_t clamp(const uint32_t divisor)
+        {
+            return ((divisor == 0) ? 0 : (divisor > UART_BAUD_UBRR_MAX + 1UL) ? UART_BAUD_UBRR_MAX : (uint16_t)(divisor - 1));
+        }
+
+        static constexpr int16_t relative(const uint32_t clock, const uint32_t nominal)
+        {
+            /* Below 100 the divisor is clamped to 1, such nominal rates saturate instead of dividing by zero */
+            return (saturate((nominal >= 1000000UL) ? ((int32_t)clock - (int32_t)nominal) / (int32_t)(nominal / 10000) :
+                             (nominal >= 100)       ? ((int32_t)clock - (int32_t)nominal) * 100 / (int32_t)(nominal / 100) :
+                                                      ((int32_t)clock - (int32_t)nominal) * 100));
+        }
+
+        static constexpr int16_t saturate(const int32_t n)
+        {
+            return ((n > INT16_MAX) ? INT16_MAX : (n < INT16_MIN) ? INT16_MIN : (int16_t)n);
+        }
+
+        static constexpr uint16_t magnitude(const int16_t n)
+        {
+            return ((n < 0) ? (uint16_t)-(int32_t)n : (uint16_t)n);
+        }
+};
+
+#endif
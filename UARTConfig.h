@@ -0,0 +1,173 @@
+#ifndef __UART_CONFIG_H__
+#define __UART_CONFIG_H__
+
+/**
+ * @brief Optional features of the UART library.
+ * @details Every feature below adds work to the interrupt service routines or SRAM to each port, so they are compiled
+ *          out unless enabled. Enable a feature for the whole project with a compiler flag (e.g. `-DUART_ENABLE_LINE_MODE=1`)
+ *          or by editing the default here. The flags must be the same for every file of the project.
+ */
+
+/**
+ * @brief Line-oriented reception.
+ * @details `isrRX()` counts the line delimiters as they arrive, so `lineAvailable()` is O(1) and `readLine()` copies a complete
+ *          line in bulk. Costs one compare per received byte and 3 bytes of SRAM per port.
+ */
+#ifndef UART_ENABLE_LINE_MODE
+#define UART_ENABLE_LINE_MODE 0
+#endif
+
+/**
+ * @brief Receive callback invoked from `isrRX()`.
+ * @details A function registered with `setRxCallback()` sees every received byte within the receive interrupt, before it is
+ *          buffered, and decides whether it is stored. Calling a function pointer from an ISR makes the compiler save every
+ *          call-clobbered register, so keep it disabled unless needed.
+ */
+#ifndef UART_ENABLE_RX_CALLBACK
+#define UART_ENABLE_RX_CALLBACK 0
+#endif
+
+/**
+ * @brief Idle-line (inter-byte timeout) frame detection.
+ * @details `isrRX()` restarts an idle counter with every byte and `tick()`, called periodically by the application (typically
+ *          from a timer interrupt running once per character time), closes the frame after a configurable number of silent
+ *          ticks. Complete frames are read with `frameAvailable()`/`readFrame()`, as needed by Modbus-RTU style protocols.
+ */
+#ifndef UART_ENABLE_IDLE_DETECT
+#define UART_ENABLE_IDLE_DETECT 0
+#endif
+
+/**
+ * @brief Number of complete frames remembered by the idle-line detection, a power of two.
+ * @details When the application does not read the frames fast enough, the following frames are merged into the last one.
+ */
+#ifndef UART_IDLE_FRAME_QUEUE_SIZE
+#define UART_IDLE_FRAME_QUEUE_SIZE 4
+#endif
+
+/**
+ * @brief Sleep while waiting for the transmitter.
+ * @details The blocking `write()`/`print()` family and `flushTx()` enter `SLEEP_MODE_IDLE` between UDRE interrupts instead of
+ *          spinning at full power. The sleep mode is set to idle before every sleep.
+ */
+#ifndef UART_ENABLE_SLEEP_WAIT
+#define UART_ENABLE_SLEEP_WAIT 0
+#endif
+
+/**
+ * @brief RS-485 half-duplex driver control.
+ * @details A driver enable (DE/RE) pin registered with `setRS485()` is asserted by `isrUDRE()` right before it writes a byte to
+ *          UDR and released from the TXC interrupt (`isrTXC()`) as soon as the stop bit of the last byte has left the shift
+ *          register, so the bus is turned around within an interrupt latency. A transmission paused by flow control releases
+ *          the bus the same way. Requires the TXC vector of each port.
+ */
+#ifndef UART_ENABLE_RS485
+#define UART_ENABLE_RS485 0
+#endif
+
+/**
+ * @brief Multi-processor communication mode (MPCM) addressing.
+ * @details With a 9-bit frame format (`UART_9N1`, ...), a node given an address with `setAddress()` lets the hardware drop
+ *          every data frame until an address frame (ninth bit set) carrying its address arrives, so `isrRX()` only runs for the
+ *          traffic of the node. A master selects a node with `writeAddress()`. Costs a few instructions per received byte.
+ */
+#ifndef UART_ENABLE_MPCM
+#define UART_ENABLE_MPCM 0
+#endif
+
+/**
+ * @brief RTS/CTS hardware flow control on GPIO pins.
+ * @details Pins registered with `setFlowControl()` are active low. `isrRX()` deasserts RTS once the receive buffer is three
+ *          quarters full and the reads assert it again at one quarter, leaving a quarter of the buffer for the bytes the peer
+ *          sends before it reacts. `isrUDRE()` pauses while CTS is deasserted; the transmission resumes from the blocking writes
+ *          or from `isrCTS()`, to be called from a pin change interrupt of the CTS pin.
+ */
+#ifndef UART_ENABLE_FLOW_CONTROL
+#define UART_ENABLE_FLOW_CONTROL 0
+#endif
+
+/**
+ * @brief Urgent transmit lane.
+ * @details `writeUrgent()` queues control bytes (ACK, XOFF, ...) into a small slot queue that `isrUDRE()` drains before the
+ *          transmit buffer, so they leave within two character times however much output is queued. Costs a compare per
+ *          transmitted byte and `UART_URGENT_QUEUE_SIZE` + 2 bytes of SRAM per port.
+ */
+#ifndef UART_ENABLE_URGENT_TX
+#define UART_ENABLE_URGENT_TX 0
+#endif
+
+/**
+ * @brief Number of bytes the urgent transmit lane holds, a power of two between 1 and 8.
+ */
+#ifndef UART_URGENT_QUEUE_SIZE
+#define UART_URGENT_QUEUE_SIZE 4
+#endif
+
+/**
+ * @brief Software XON/XOFF flow control for 3-wire links.
+ * @details Once enabled with `setXonXoff()`, `isrRX()` consumes the XON/XOFF bytes of the peer without buffering them and gates
+ *          `isrUDRE()` with them. It also sends XOFF through the urgent lane once the receive buffer is three quarters full;
+ *          the reads send XON again at one quarter. While the peer holds XOFF, `flushTx()` and `end()` block until it sends XON.
+ *          In RS-485 mode the driver is released during the pause, so the peer can answer on a half-duplex bus. Requires
+ *          `UART_ENABLE_URGENT_TX`.
+ */
+#ifndef UART_ENABLE_XON_XOFF
+#define UART_ENABLE_XON_XOFF 0
+#endif
+
+#if UART_ENABLE_XON_XOFF && !UART_ENABLE_URGENT_TX
+#error "UART_ENABLE_XON_XOFF requires UART_ENABLE_URGENT_TX"
+#endif
+
+/**
+ * @brief Master SPI mode (MSPIM) transfer engine.
+ * @details `beginSPI()` switches the USART to Master SPI mode and `transfer()` queues buffers to exchange with the slave. Two
+ *          transfers can be queued, so the next buffer is handed over while the current one is clocked out and the 2-byte
+ *          transmit pipeline (UDR and shift register) never runs dry between them. Costs a compare per interrupt in
+ *          asynchronous mode and 21 bytes of SRAM per port.
+ */
+#ifndef UART_ENABLE_MSPIM
+#define UART_ENABLE_MSPIM 0
+#endif
+
+/**
+ * @brief GPIO trace of the interrupt service routines.
+ * @details Every RX and UDRE vector of the library sets a pin on entry and clears it on exit, so the ISR timing (latency, duration,
+ *          load) can be checked with a logic analyzer or an oscilloscope. The pins are shared by all ports and must be configured
+ *          as outputs by the application. Costs two `sbi`/`cbi` instructions per interrupt.
+ */
+#ifndef UART_ENABLE_ISR_TRACE
+#define UART_ENABLE_ISR_TRACE 0
+#endif
+
+#ifndef UART_TRACE_PORT
+#define UART_TRACE_PORT PORTB /**< PORTx register of the trace pins */
+#endif
+#ifndef UART_TRACE_RX_BIT
+#define UART_TRACE_RX_BIT 0   /**< Trace pin of the RX vectors */
+#endif
+#ifndef UART_TRACE_UDRE_BIT
+#define UART_TRACE_UDRE_BIT 1 /**< Trace pin of the UDRE vectors */
+#endif
+
+/**
+ * @brief Ports built by the library.
+ * @details Each port instance, its buffers and its interrupt service routines live in their own translation unit. Linked as an
+ *          archive (`dot_a_linkage` in `library.properties`), a port the application never references costs nothing. Build
+ *          systems linking every object file (e.g. a `Microchip Studio` project) keep all of them, so setting `UART_USE_PORTn`
+ *          to 0 drops the instance and the vectors of port n, which also leaves them free for another library.
+ */
+#ifndef UART_USE_PORT0
+#define UART_USE_PORT0 1
+#endif
+#ifndef UART_USE_PORT1
+#define UART_USE_PORT1 1
+#endif
+#ifndef UART_USE_PORT2
+#define UART_USE_PORT2 1
+#endif
+#ifndef UART_USE_PORT3
+#define UART_USE_PORT3 1
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef __UART_PORT_H__
+#define __UART_PORT_H__
+
+/* Dependencies */
+#include <stdint.h>
+#include <avr/io.h>
+
+/**
+ * @brief USART table of the supported microcontrollers.
+ * @details For every USART of the device, `UART_HAS_PORTn` is set to 1 and `UARTn_RX_VECTOR`, `UARTn_UDRE_VECTOR` and
+ *          `UARTn_TX_VECTOR` name its interrupt vectors. Each port instance and its interrupt service routines live in their
+ *          own translation unit (`UART0.cpp` ... `UART3.cpp`), see `UART_USE_PORTn` in `UARTConfig.h`.
+ */
+#if defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega328P__)
+#define UART_HAS_PORT0    1
+#define UART0_RX_VECTOR   USART_RX_vect
+#define UART0_UDRE_VECTOR USART_UDRE_vect
+#define UART0_TX_VECTOR   USART_TX_vect
+#elif defined(__AVR_ATmega328PB__)  || \
+      defined(__AVR_ATmega164A__)   || \
+      defined(__AVR_ATmega164P__)   || \
+      defined(__AVR_ATmega164PA__)  || \
+      defined(__AVR_ATmega324A__)   || \
+      defined(__AVR_ATmega324P__)   || \
+      defined(__AVR_ATmega324PA__)  || \
+      defined(__AVR_ATmega644A__)   || \
+      defined(__AVR_ATmega644P__)   || \
+      defined(__AVR_ATmega644PA__)  || \
+      defined(__AVR_ATmega1284__)   || \
+      defined(__AVR_ATmega1284P__)  || \
+      defined(__AVR_ATmega1281__)   || \
+      defined(__AVR_ATmega2561__)
+#define UART_HAS_PORT0    1
+#define UART0_RX_VECTOR   USART0_RX_vect
+#define UART0_UDRE_VECTOR USART0_UDRE_vect
+#define UART0_TX_VECTOR   USART0_TX_vect
+#define UART_HAS_PORT1    1
+#define UART1_RX_VECTOR   USART1_RX_vect
+#define UART1_UDRE_VECTOR USART1_UDRE_vect
+#define UART1_TX_VECTOR   USART1_TX_vect
+#elif defined(__AVR_ATmega640__)  || \
+      defined(__AVR_ATmega1280__) || \
+      defined(__AVR_ATmega2560__)
+#define UART_HAS_PORT0    1
+#define UART0_RX_VECTOR   USART0_RX_vect
+#define UART0_UDRE_VECTOR USART0_UDRE_vect
+#define UART0_TX_VECTOR   USART0_TX_vect
+#define UART_HAS_PORT1    1
+#define UART1_RX_VECTOR   USART1_RX_vect
+#define UART1_UDRE_VECTOR USART1_UDRE_vect
+#define UART1_TX_VECTOR   USART1_TX_vect
+#define UART_HAS_PORT2    1
+#define UART2_RX_VECTOR   USART2_RX_vect
+#define UART2_UDRE_VECTOR USART2_UDRE_vect
+#define UART2_TX_VECTOR   USART2_TX_vect
+#define UART_HAS_PORT3    1
+#define UART3_RX_VECTOR   USART3_RX_vect
+#define UART3_UDRE_VECTOR USART3_UDRE_vect
+#define UART3_TX_VECTOR   USART3_TX_vect
+#elif defined(__AVR_ATmega16U4__) || \
+      defined(__AVR_ATmega32U4__)
+#define UART_HAS_PORT1    1
+#define UART1_RX_VECTOR   USART1_RX_vect
+#define UART1_UDRE_VECTOR USART1_UDRE_vect
+#define UART1_TX_VECTOR   USART1_TX_vect
+#else
+#error "Can't describe the UART buses of this microcontroller"
+#endif
+
+#ifndef UART_HAS_PORT0
+#define UART_HAS_PORT0 0
+#endif
+#ifndef UART_HAS_PORT1
+#define UART_HAS_PORT1 0
+#endif
+#ifndef UART_HAS_PORT2
+#define UART_HAS_PORT2 0
+#endif
+#ifndef UART_HAS_PORT3
+#define UART_HAS_PORT3 0
+#endif
+
+/**
+ * @brief USART 0 bit names on devices without a USART 0.
+ * @details The bit positions inside the registers are the same for every USART, so the implementation uses the USART 0 bit
+ *          names (`U2X0`, `RXEN0`, `UDRIE0`, ...) for all ports. Devices whose only USART is USART 1 (ATmega16U4/32U4) get
+ *          them as aliases of the USART 1 names.
+ */
+#if !defined(U2X0) && defined(U2X1)
+#define MPCM0   MPCM1
+#define U2X0    U2X1
+#define UPE0    UPE1
+#define DOR0    DOR1
+#define FE0     FE1
+#define UDRE0   UDRE1
+#define TXC0    TXC1
+#define RXC0    RXC1
+#define TXB80   TXB81
+#define RXB80   RXB81
+#define UCSZ02  UCSZ12
+#define TXEN0   TXEN1
+#define RXEN0   RXEN1
+#define UDRIE0  UDRIE1
+#define TXCIE0  TXCIE1
+#define RXCIE0  RXCIE1
+#define UCPOL0  UCPOL1
+#define UCSZ00  UCSZ10
+#define UCSZ01  UCSZ11
+#define USBS0   USBS1
+#define UPM00   UPM10
+#define UPM01   UPM11
+#define UMSEL00 UMSEL10
+#define UMSEL01 UMSEL11
+#endif
+
+/**
+ * @brief Declares the compile-time descriptor of USART `N`.
+ * @details Every descriptor is a stateless struct exposing the registers of one USART as `static inline` accessors returning
+ *          a reference to the register. Because the register addresses are resolved at compile time, the `__UART__` template
+ *          instantiated with a descriptor accesses the hardware with direct `lds`/`sts` instructions instead of loading a
+ *          register pointer through `this`, which keeps `isrRX()` and `isrUDRE()` as short as possible.
+ *          The accessors return UBRRnH, UBRRnL, UCSRnA, UCSRnB, UCSRnC and UDRn.
+ */
+#define UART_DESCRIBE_PORT(N)                                            \
+struct __UART##N##_PORT__                                                \
+{                                                                        \
+    static inline volatile uint8_t& ubrrh(void) { return (UBRR##N##H); } \
+    static inline volatile uint8_t& ubrrl(void) { return (UBRR##N##L); } \
+    static inline volatile uint8_t& ucsra(void) { return (UCSR##N##A); } \
+    static inline volatile uint8_t& ucsrb(void) { return (UCSR##N##B); } \
+    static inline volatile uint8_t& ucsrc(void) { return (UCSR##N##C); } \
+    static inline volatile uint8_t& udr(void)   { return (UDR##N);     } \
+}
+
+#if UART_HAS_PORT0
+UART_DESCRIBE_PORT(0);
+#endif
+
+#if UART_HAS_PORT1
+UART_DESCRIBE_PORT(1);
+#endif
+
+#if UART_HAS_PORT2
+UART_DESCRIBE_PORT(2);
+#endif
+
+#if UART_HAS_PORT3
+UART_DESCRIBE_PORT(3);
+#endif
+
+#endif
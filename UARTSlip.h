@@ -0,0 +1,123 @@
+#ifndef __UART_SLIP_H__
+#define __UART_SLIP_H__
+
+/* Dependencies */
+#include <stdint.h>
+#include "CRC.h"
+
+/**
+ * @brief SLIP (RFC 1055) special characters.
+ */
+#define SLIP_END     (const uint8_t)0xC0 /**< Frame delimiter */
+#define SLIP_ESC     (const uint8_t)0xDB /**< Escape character */
+#define SLIP_ESC_END (const uint8_t)0xDC /**< Escaped frame delimiter */
+#define SLIP_ESC_ESC (const uint8_t)0xDD /**< Escaped escape character */
+
+/**
+ * @brief SLIP framing with a CRC-16 trailer on top of a `__UART__` port.
+ * @details Frames are delimited by `SLIP_END`, the payload is followed by its CRC-16/CCITT-FALSE (most significant byte first)
+ *          and the whole frame is escaped. The encoder escapes and checksums the payload in one pass straight into spans of
+ *          the transmit buffer obtained with `reserve()`, so no encoded copy of the frame is staged in SRAM. The decoder walks
+ *          the receive buffer in place with `peekSpan()`, unescapes into its frame buffer and updates the CRC byte by byte.
+ * @tparam UART The `__UART__` instantiation carrying the frames
+ * @tparam SIZE The largest frame accepted by the decoder, payload and CRC included, at most 255 bytes
+ * @code
+ * UARTSlip<decltype(UART0)> link(UART0);
+ * link.send(packet, sizeof(packet));
+ * const uint8_t length = link.poll();
+ * if (length)
+ *     handle(link.frame(), length);
+ * @endcode
+ */
+template <class UART, uint16_t SIZE = 64>
+class UARTSlip
+{
+    static_assert(SIZE >= 3 && SIZE <= 255, "UARTSlip frame size must be between 3 and 255 bytes");
+
+    public:
+        /**
+         * @brief UARTSlip constructor
+         * @param uart The port carrying the frames
+         */
+        UARTSlip(UART& uart);
+
+        /**
+         * @brief Sends a complete frame
+         * @param n Pointer to the payload
+         * @param size The number of payload bytes
+         */
+        void send(const uint8_t* n, const uint8_t size);
+
+        /**
+         * @brief Starts a frame sent in pieces with `write()`
+         */
+        void beginFrame(void);
+
+        /**
+         * @brief Appends payload bytes to the frame started with `beginFrame()`
+         * @param n Pointer to the payload bytes
+         * @param size The number of bytes
+         */
+        void write(const uint8_t* n, const uint8_t size);
+
+        /**
+         * @brief Ends the frame started with `beginFrame()` with its CRC and the frame delimiter
+         */
+        void endFrame(void);
+
+        /**
+         * @brief Decodes the received bytes
+         * @return The payload length of a complete frame with a valid CRC, available at `frame()` until the next call, or 0
+         */
+        const uint8_t poll(void);
+
+        /**
+         * @brief Returns the payload of the frame returned by `poll()`
+         * @return Pointer to the decoder buffer
+         */
+        const uint8_t* frame(void);
+
+        /**
+         * @brief Returns the number of frames dropped by the decoder
+         * @return Frames discarded because of a CRC mismatch, a too long frame or an invalid escape
+         */
+        const uint16_t dropped(void);
+
+    private:
+        /**
+         * @brief Escapes bytes into the transmit buffer
+         * @param n Pointer to the bytes
+         * @param size The number of bytes
+         * @param checksum 1 to add the bytes to the CRC of the frame
+         */
+        void encode(const uint8_t* n, uint8_t size, const uint8_t checksum);
+
+        /**
+         * @brief Escapes one byte
+         * @param byte The byte
+         * @param p Destination, at least 2 bytes
+         * @return The number of bytes written
+         */
+        static const uint8_t escape(const uint8_t byte, uint8_t* p);
+
+        /**
+         * @brief Feeds one received byte to the decoder
+         * @param byte The received byte
+         * @return The payload length once a valid frame is complete, 0 otherwise
+         */
+        const uint8_t decode(uint8_t byte);
+
+        UART& uart;              /**< Port carrying the frames */
+        uint16_t txCrc;          /**< CRC of the frame being sent */
+        uint16_t rxCrc;          /**< CRC of the frame being received */
+        uint8_t rxBuffer[SIZE];  /**< Unescaped frame being received */
+        uint8_t rxLength;        /**< Bytes in `rxBuffer` */
+        uint8_t rxEscape;        /**< The previous byte was `SLIP_ESC` */
+        uint8_t rxDiscard;       /**< The frame being received is invalid, skip to the next `SLIP_END` */
+        uint16_t rxDropped;      /**< Frames dropped by the decoder */
+};
+
+/* Implementation */
+#include "UARTSlip.tpp"
+
+#endif
@@ -0,0 +1,226 @@
+/* Implementation of the UARTSlip template, included by UARTSlip.h */
+
+/**
+ * @brief UARTSlip constructor
+ * @param uart The port carrying the frames
+ */
+template <class UART, uint16_t SIZE>
+UARTSlip<UART, SIZE>::UARTSlip(UART& uart) : uart(uart)
+{
+    this->txCrc = CRC16_INIT;
+    this->rxCrc = CRC16_INIT;
+    this->rxLength = 0;
+    this->rxEscape = 0;
+    this->rxDiscard = 0;
+    this->rxDropped = 0;
+}
+
+/**
+ * @brief Sends a complete frame
+ * @param n Pointer to the payload
+ * @param size The number of payload bytes
+ * @details A frame without payload carries only its CRC, `poll()` on the peer skips it since it reports frames by length.
+ */
+template <class UART, uint16_t SIZE>
+void UARTSlip<UART, SIZE>::send(const uint8_t* n, const uint8_t size)
+{
+    this->beginFrame();
+    this->write(n, size);
+    this->endFrame();
+}
+
+/**
+ * @brief Starts a frame sent in pieces with `write()`
+ * @details A leading delimiter flushes any line noise received by the peer before the frame.
+ */
+template <class UART, uint16_t SIZE>
+void UARTSlip<UART, SIZE>::beginFrame(void)
+{
+    this->txCrc = CRC16_INIT;
+    this->uart.write(SLIP_END);
+}
+
+/**
+ * @brief Appends payload bytes to the frame started with `beginFrame()`
+ * @param n Pointer to the payload bytes
+ * @param size The number of bytes
+ */
+template <class UART, uint16_t SIZE>
+void UARTSlip<UART, SIZE>::write(const uint8_t* n, const uint8_t size)
+{
+    this->encode(n, size, 1);
+}
+
+/**
+ * @brief Ends the frame started with `beginFrame()` with its CRC and the frame delimiter
+ */
+template <class UART, uint16_t SIZE>
+void UARTSlip<UART, SIZE>::endFrame(void)
+{
+    const uint8_t crc[2] = { (uint8_t)(this->txCrc >> 8), (uint8_t)this->txCrc };
+    this->encode(crc, sizeof(crc), 0);
+    this->uart.write(SLIP_END);
+}
+
+/**
+ * @brief Decodes the received bytes
+ * @return The payload length of a complete frame with a valid CRC, available at `frame()` until the next call, or 0
+ * @details The receive buffer is read in place with `peekSpan()`. Decoding stops right after the delimiter of a valid frame,
+ *          the following bytes are left in the receive buffer for the next call.
+ */
+template <class UART, uint16_t SIZE>
+const uint8_t UARTSlip<UART, SIZE>::poll(void)
+{
+    const uint8_t* p;
+    uint8_t count;
+    while ((count = this->uart.peekSpan(&p)) != 0)
+    {
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const uint8_t length = this->decode(p[i]);
+            if (length)
+            {
+                this->uart.consume(i + 1);
+                return (length);
+            }
+        }
+        this->uart.consume(count);
+    }
+    return (0);
+}
+
+/**
+ * @brief Returns the payload of the frame returned by `poll()`
+ * @return Pointer to the decoder buffer
+ */
+template <class UART, uint16_t SIZE>
+const uint8_t* UARTSlip<UART, SIZE>::frame(void)
+{
+    return (this->rxBuffer);
+}
+
+/**
+ * @brief Returns the number of frames dropped by the decoder
+ * @return Frames discarded because of a CRC mismatch, a too long frame or an invalid escape
+ */
+template <class UART, uint16_t SIZE>
+const uint16_t UARTSlip<UART, SIZE>::dropped(void)
+{
+    return (this->rxDropped);
+}
+
+/**
+ * @brief Escapes bytes into the transmit buffer
+ * @param n Pointer to the bytes
+ * @param size The number of bytes
+ * @param checksum 1 to add the bytes to the CRC of the frame
+ * @details The bytes are escaped straight into the span returned by `reserve()`, stopping one byte before its end so an
+ *          escape sequence always fits, then published with `commit()`. When less than two bytes are contiguous (full
+ *          transmit buffer or wrap around point), a single escaped byte goes through `write()`, which applies the overflow
+ *          policy of the port.
+ */
+template <class UART, uint16_t SIZE>
+void UARTSlip<UART, SIZE>::encode(const uint8_t* n, uint8_t size, const uint8_t checksum)
+{
+    uint16_t crc = this->txCrc;
+    while (size)
+    {
+        uint8_t* p;
+        const uint8_t room = this->uart.reserve(&p, UINT8_MAX);
+        if (room < 2)
+        {
+            uint8_t pair[2];
+            if (checksum)
+                crc = CRC::crc16(crc, *n);
+            this->uart.write(pair, UARTSlip::escape(*n++, pair));
+            size--;
+            continue;
+        }
+
+        uint8_t used = 0;
+        while (size && used < room - 1)
+        {
+            if (checksum)
+                crc = CRC::crc16(crc, *n);
+            used += UARTSlip::escape(*n++, p + used);
+            size--;
+        }
+        this->uart.commit(used);
+    }
+    this->txCrc = crc;
+}
+
+/**
+ * @brief Escapes one byte
+ * @param byte The byte
+ * @param p Destination, at least 2 bytes
+ * @return The number of bytes written
+ */
+template <class UART, uint16_t SIZE>
+const uint8_t UARTSlip<UART, SIZE>::escape(const uint8_t byte, uint8_t* p)
+{
+    if (byte == SLIP_END || byte == SLIP_ESC)
+    {
+        p[0] = SLIP_ESC;
+        p[1] = (byte == SLIP_END) ? SLIP_ESC_END : SLIP_ESC_ESC;
+        return (2);
+    }
+    p[0] = byte;
+    return (1);
+}
+
+/**
+ * @brief Feeds one received byte to the decoder
+ * @param byte The received byte
+ * @return The payload length once a valid frame is complete, 0 otherwise
+ * @details The CRC runs over the payload and its trailer, a valid frame leaves a CRC of 0. Empty frames between back to back
+ *          delimiters and valid frames without payload (sent with `send(p, 0)`) are ignored without being counted as dropped.
+ */
+template <class UART, uint16_t SIZE>
+const uint8_t UARTSlip<UART, SIZE>::decode(uint8_t byte)
+{
+    if (byte == SLIP_END)
+    {
+        uint8_t length = 0;
+        if (!this->rxDiscard && !this->rxEscape && this->rxLength >= 2 && !this->rxCrc)
+            length = (uint8_t)(this->rxLength - 2); /*!< 0 for a valid frame without payload */
+        else if (this->rxLength || this->rxDiscard || this->rxEscape)
+            this->rxDropped++;
+        this->rxCrc = CRC16_INIT;
+        this->rxLength = 0;
+        this->rxEscape = 0;
+        this->rxDiscard = 0;
+        return (length);
+    }
+
+    if (this->rxDiscard)
+        return (0);
+
+    if (this->rxEscape)
+    {
+        this->rxEscape = 0;
+        if (byte == SLIP_ESC_END)
+            byte = SLIP_END;
+        else if (byte == SLIP_ESC_ESC)
+            byte = SLIP_ESC;
+        else
+        {
+            this->rxDiscard = 1;
+            return (0);
+        }
+    }
+    else if (byte == SLIP_ESC)
+    {
+        this->rxEscape = 1;
+        return (0);
+    }
+
+    if (this->rxLength == SIZE)
+    {
+        this->rxDiscard = 1;
+        return (0);
+    }
+    this->rxBuffer[this->rxLength++] = byte;
+    this->rxCrc = CRC::crc16(this->rxCrc, byte);
+    return (0);
+}
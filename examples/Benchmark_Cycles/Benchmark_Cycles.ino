@@ -0,0 +1,175 @@
+#include <UART.h>
+
+/*
+ * Measures the CPU cycles of the library hot paths with Timer1 counting at F_CPU:
+ * print(uint32_t), println(int32_t), printf(), bulk write(), isrUDRE() and isrRX().
+ * Connect TX to RX (loopback jumper) to measure isrRX(), the measurement is skipped otherwise.
+ * Build with -DUART_ENABLE_ISR_TRACE=1 to watch the RX (PB0) and UDRE (PB1) vectors on a logic analyzer.
+ * On the ATmega16U4/32U4, set BENCH_UART to UART1 and BENCH_UCSRA to UCSR1A.
+ */
+
+#define BENCH_UART     UART0
+#define BENCH_UCSRA    UCSR0A /* Status register of BENCH_UART, polled for RXC */
+#define BENCH_BAUDRATE 115200
+#define BENCH_RUNS     16
+
+/* Timer1 ticks spent by an empty measurement */
+static uint16_t overhead;
+
+/* Runs the code with interrupts disabled and stores the elapsed cycles */
+#define MEASURE(cycles, ...)                      \
+    do                                            \
+    {                                             \
+        cli();                                    \
+        const uint16_t start = TCNT1;             \
+        __VA_ARGS__;                              \
+        cycles = TCNT1 - start - overhead;        \
+        sei();                                    \
+    } while (0)
+
+static const uint8_t block[32] = { 'U', 'A', 'R', 'T', ' ', 'b', 'u', 'l', 'k', ' ', 'w', 'r', 'i', 't', 'e', ' ',
+                                   '3', '2', ' ', 'b', 'y', 't', 'e', 's', ' ', 'b', 'l', 'o', 'c', 'k', '\r', '\n' };
+
+static void track(const uint16_t cycles, uint16_t* best, uint16_t* worst)
+{
+    if (cycles < *best)
+        *best = cycles;
+    if (cycles > *worst)
+        *worst = cycles;
+}
+
+static void report(const FlashStringHelper& name, const uint16_t best, const uint16_t worst)
+{
+    BENCH_UART.flushTx();
+    BENCH_UART.print(name);
+    BENCH_UART.printf(F(": best %u, worst %u cycles\n"), best, worst);
+}
+
+static void benchPrint(void)
+{
+    uint16_t best = UINT16_MAX, worst = 0, cycles;
+    for (uint8_t i = 0; i < BENCH_RUNS; i++)
+    {
+        BENCH_UART.flushTx();
+        MEASURE(cycles, BENCH_UART.print((const uint32_t)UINT32_MAX - i));
+        track(cycles, &best, &worst);
+        BENCH_UART.write((const uint8_t)' ');
+    }
+    BENCH_UART.println();
+    report(F("print(uint32_t)"), best, worst);
+
+    best = UINT16_MAX;
+    worst = 0;
+    for (uint8_t i = 0; i < BENCH_RUNS; i++)
+    {
+        BENCH_UART.flushTx();
+        MEASURE(cycles, BENCH_UART.println((const int32_t)INT32_MIN + i));
+        track(cycles, &best, &worst);
+    }
+    report(F("println(int32_t)"), best, worst);
+
+    best = UINT16_MAX;
+    worst = 0;
+    for (uint8_t i = 0; i < BENCH_RUNS; i++)
+    {
+        BENCH_UART.flushTx();
+        MEASURE(cycles, BENCH_UART.printf(F("t=%u v=%04x\n"), (const uint16_t)i, (const uint16_t)(i * 0x111)));
+        track(cycles, &best, &worst);
+    }
+    report(F("printf(2 args)"), best, worst);
+}
+
+static void benchWrite(void)
+{
+    uint16_t best = UINT16_MAX, worst = 0, cycles;
+    for (uint8_t i = 0; i < BENCH_RUNS; i++)
+    {
+        BENCH_UART.flushTx();
+        MEASURE(cycles, BENCH_UART.write(block, sizeof(block)));
+        track(cycles, &best, &worst);
+    }
+    report(F("write(32 bytes)"), best, worst);
+}
+
+static void benchUDRE(void)
+{
+    uint16_t best = UINT16_MAX, worst = 0, cycles;
+    BENCH_UART.flushTx();
+    cli();
+    BENCH_UART.tryWrite(block, sizeof(block)); /* UDRIE is armed but the vector can't run */
+    for (uint8_t i = 0; i < sizeof(block); i++)
+    {
+        _delay_us(2 * 10 * 1000000.0 / BENCH_BAUDRATE); /* UDR is free again */
+        const uint16_t start = TCNT1;
+        BENCH_UART.isrUDRE();
+        cycles = TCNT1 - start - overhead;
+        track(cycles, &best, &worst);
+    }
+    sei();
+    report(F("isrUDRE()"), best, worst);
+}
+
+/* Waits up to 4 byte times for the receive complete flag */
+static uint8_t rxReady(void)
+{
+    for (uint16_t us = 0; us < 4 * 10 * 1000000UL / BENCH_BAUDRATE; us++)
+    {
+        if (BENCH_UCSRA & (1 << RXC0))
+            return (1);
+        _delay_us(1);
+    }
+    return (0);
+}
+
+static void benchRX(void)
+{
+    uint16_t best = UINT16_MAX, worst = 0, cycles;
+    uint8_t measured = 0;
+    BENCH_UART.flushTx();
+    BENCH_UART.flush();
+    cli();
+    for (; measured < BENCH_RUNS; measured++)
+    {
+        BENCH_UART.tryWrite(&measured, 1);
+        BENCH_UART.isrUDRE(); /* Send the byte to the loopback */
+        if (!rxReady())
+            break;            /* Nothing came back, isrRX() would read a stale UDR */
+        const uint16_t start = TCNT1;
+        BENCH_UART.isrRX();
+        cycles = TCNT1 - start - overhead;
+        track(cycles, &best, &worst);
+    }
+    sei();
+    uint8_t valid = (measured == BENCH_RUNS) && (BENCH_UART.available() == BENCH_RUNS);
+    for (uint8_t i = 0; valid && i < BENCH_RUNS; i++)
+        valid = (BENCH_UART.read() == i);
+    BENCH_UART.flush();
+    if (valid)
+        report(F("isrRX()"), best, worst);
+    else
+        BENCH_UART.println(F("isrRX(): skipped, connect TX to RX"));
+}
+
+void setup(void)
+{
+    TCCR1A = 0;
+    TCCR1B = (1 << CS10); /* Timer1 counts CPU cycles */
+    MEASURE(overhead, (void)0);
+
+    #if UART_ENABLE_ISR_TRACE
+    DDRB |= (1 << UART_TRACE_RX_BIT) | (1 << UART_TRACE_UDRE_BIT);
+    #endif
+
+    BENCH_UART.begin(BENCH_BAUDRATE);
+    BENCH_UART.println(F("UART - Benchmark cycles"));
+    BENCH_UART.printf(F("F_CPU %u Hz, %u baud\n"), (const uint32_t)F_CPU, (const uint32_t)BENCH_BAUDRATE);
+    benchPrint();
+    benchWrite();
+    benchUDRE();
+    benchRX();
+    BENCH_UART.println(F("Done"));
+}
+
+void loop(void)
+{
+}
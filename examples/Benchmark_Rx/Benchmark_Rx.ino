@@ -0,0 +1,78 @@
+#include <UART.h>
+
+/*
+ * Measures the sustained reception at 115200, 250000, 500000 and 1000000 baud with zero-loss verification.
+ * Run extras/benchmark.py on the host: for every rate the sketch announces "READY <baud> <bytes>", the host sends the byte
+ * sequence 0, 1, 2, ... 255, 0, ... and the sketch answers with a "RESULT" line once the sequence is complete or the line has
+ * been idle for BENCH_IDLE_MS. The worst-case latency is the time the oldest byte waited in the receive buffer, derived from
+ * the high-water mark.
+ * On the ATmega16U4/32U4, set BENCH_UART to UART1.
+ */
+
+#define BENCH_UART    UART0
+#define BENCH_BYTES   16384UL
+#define BENCH_IDLE_MS 250
+#define BENCH_LOAD_US 0 /* Busy time simulating the application between two reads */
+
+static const uint32_t RATES[] = { 115200, 250000, 500000, 1000000 };
+
+static void bench(const uint32_t baudrate)
+{
+    uint8_t buffer[32];
+    uint32_t received = 0, mismatches = 0, first = 0, last = 0, announced = 0;
+    uint8_t expected = 0;
+
+    BENCH_UART.begin(baudrate);
+    BENCH_UART.flush();
+    BENCH_UART.resetStats();
+
+    while (!BENCH_UART.available())
+    {
+        if (millis() - announced >= BENCH_IDLE_MS)
+        {
+            BENCH_UART.printf(F("READY %u %u\n"), baudrate, (const uint32_t)BENCH_BYTES);
+            announced = millis();
+        }
+    }
+    first = micros();
+    last = millis();
+
+    while (received < BENCH_BYTES && millis() - last < BENCH_IDLE_MS)
+    {
+        const uint8_t count = BENCH_UART.readAvailable(buffer, sizeof(buffer));
+        if (!count)
+            continue;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (buffer[i] != expected)
+                mismatches++;
+            expected = buffer[i] + 1;
+        }
+        received += count;
+        last = millis();
+        #if BENCH_LOAD_US
+        _delay_us(BENCH_LOAD_US);
+        #endif
+    }
+    const uint32_t elapsed = micros() - first;
+
+    const UARTStats stats = BENCH_UART.stats();
+    const uint32_t rate = (uint32_t)(received * 100000UL / ((elapsed / 10) ? (elapsed / 10) : 1));
+    const uint32_t latency = (uint32_t)stats.highWater * 10UL * 1000000UL / baudrate;
+    const uint32_t lost = (received < BENCH_BYTES) ? BENCH_BYTES - received : 0;
+    BENCH_UART.printf(F("RESULT baud=%u bytes=%u lost=%u mismatches=%u overrun=%u framing=%u overflow=%u Bps=%u highWater=%u latency=%uus %s\n"),
+                      baudrate, received, lost, mismatches, stats.overrun, stats.framing, stats.overflow,
+                      rate, stats.highWater, latency, (!lost && !mismatches) ? "PASS" : "FAIL");
+    BENCH_UART.flushTx();
+    BENCH_UART.end();
+}
+
+void setup(void)
+{
+}
+
+void loop(void)
+{
+    for (uint8_t i = 0; i < sizeof(RATES) / sizeof(RATES[0]); i++)
+        bench(RATES[i]);
+}
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Host side of examples/Benchmark_Rx.
+
+For every rate announced by the sketch ("READY <baud> <bytes>"), opens the serial port at that rate, sends the byte sequence
+0, 1, 2, ... 255, 0, ... as fast as the adapter allows and prints the "RESULT" line returned by the sketch.
+
+Requires pyserial (pip install pyserial) and a USB-serial adapter supporting the tested rates.
+"""
+
+import argparse
+import sys
+import time
+
+import serial
+
+RATES = (115200, 250000, 500000, 1000000)
+
+
+def wait_ready(port, baudrate, timeout):
+    """Returns the number of bytes requested by the sketch once it announces the rate."""
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        fields = port.readline().decode("ascii", "replace").split()
+        if len(fields) == 3 and fields[0] == "READY" and fields[1] == str(baudrate):
+            return int(fields[2])
+    return None
+
+
+def run(port, baudrate, timeout):
+    port.baudrate = baudrate
+    size = wait_ready(port, baudrate, timeout)
+    if size is None:
+        return "RESULT baud=%d no READY from the sketch" % baudrate
+    port.reset_input_buffer()
+    start = time.monotonic()
+    port.write(bytes(i & 0xFF for i in range(size)))
+    port.flush()
+    sent = time.monotonic() - start
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        line = port.readline().decode("ascii", "replace").strip()
+        if line.startswith("RESULT"):
+            return "%s host=%dBps" % (line, size / sent if sent else 0)
+    return "RESULT baud=%d no RESULT from the sketch" % baudrate
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("device", help="serial port of the board, e.g. /dev/ttyUSB0 or COM3")
+    parser.add_argument("--rates", type=int, nargs="+", default=RATES, help="baud rates in the order of the sketch")
+    parser.add_argument("--timeout", type=float, default=5.0, help="seconds to wait for the sketch")
+    args = parser.parse_args()
+
+    failed = False
+    # The port stays open and only changes rate, reopening it would reset most Arduino boards through DTR
+    with serial.Serial(args.device, args.rates[0], timeout=0.5) as port:
+        for baudrate in args.rates:
+            result = run(port, baudrate, args.timeout)
+            print(result)
+            failed |= "PASS" not in result
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())